@@ -8,7 +8,7 @@
       'defines': [
           'GAUSS_LIBRARY','SWIGJAVASCRIPT'
       ],
-      "sources": ["src/gauss.cpp", "src/gematrix.cpp", "src/gearray.cpp", "src/gestringarray.cpp", "src/geworkspace.cpp", "src/workspacemanager.cpp", "src/gesymbol.cpp", "node/gauss_wrap.cpp"],
+      "sources": ["src/gauss.cpp", "src/gematrix.cpp", "src/gearray.cpp", "src/gestringarray.cpp", "src/geworkspace.cpp", "src/workspacemanager.cpp", "src/gesymbol.cpp", "src/gematrixview.cpp", "src/gebuffer.cpp", "src/gekernels.cpp", "src/gearrayslice.cpp", "src/geprogramcache.cpp", "src/geproccall.cpp", "src/geworkerpool.cpp", "src/gecancellationtoken.cpp", "src/gemappedfile.cpp", "src/geprofile.cpp", "src/gebatchresult.cpp", "src/geworkspacepool.cpp", "src/geworkspacesnapshot.cpp", "node/gauss_wrap.cpp"],
       "conditions": [
         ["OS=='win'", {
           "libraries": [
@@ -16,6 +16,70 @@
 
 #ifdef SWIGPYTHON
 %include "pyabc.i"
+
+/*
+ * The module is built with thread support. The GIL is released only around calls that enter the
+ * engine or copy symbol data, so Python threads working on separate workspaces run in parallel.
+ * Directors take the GIL back before calling into Python, which covers the output and input
+ * hooks. Everything else, including the %extend helpers that use the Python API, keeps the GIL.
+ */
+%feature("nothreadallow");
+%feature("nothreadallow", "0") GAUSS::initialize;
+%feature("nothreadallow", "0") GAUSS::shutdown;
+%feature("nothreadallow", "0") GAUSS::createWorkspace;
+%feature("nothreadallow", "0") GAUSS::destroyWorkspace;
+%feature("nothreadallow", "0") GAUSS::destroyAllWorkspaces;
+%feature("nothreadallow", "0") GAUSS::cloneWorkspace;
+%feature("nothreadallow", "0") GAUSS::cloneWorkspaces;
+%feature("nothreadallow", "0") GAUSS::loadWorkspace;
+%feature("nothreadallow", "0") GAUSS::saveWorkspace;
+%feature("nothreadallow", "0") GAUSS::snapshotWorkspace;
+%feature("nothreadallow", "0") GAUSS::restoreWorkspace;
+%feature("nothreadallow", "0") GAUSS::saveProgram;
+%feature("nothreadallow", "0") GAUSS::translateDataloopFile;
+%feature("nothreadallow", "0") GAUSS::executeString;
+%feature("nothreadallow", "0") GAUSS::executeFile;
+%feature("nothreadallow", "0") GAUSS::executeCompiledFile;
+%feature("nothreadallow", "0") GAUSS::executeProgram;
+%feature("nothreadallow", "0") GAUSS::profileProgram;
+%feature("nothreadallow", "0") GAUSS::executeBatch;
+%feature("nothreadallow", "0") GAUSS::compileString;
+%feature("nothreadallow", "0") GAUSS::compileFile;
+%feature("nothreadallow", "0") GAUSS::compileExpression;
+%feature("nothreadallow", "0") GAUSS::loadCompiledFile;
+%feature("nothreadallow", "0") GAUSS::loadCompiledBuffer;
+%feature("nothreadallow", "0") GAUSS::evaluate;
+%feature("nothreadallow", "0") GAUSS::evaluateScalar;
+%feature("nothreadallow", "0") GAUSS::freeProgram;
+%feature("nothreadallow", "0") GAUSS::callProc;
+%feature("nothreadallow", "0") GAUSS::waitForAsync;
+%feature("nothreadallow", "0") GAUSS::setAsyncThreadCount;
+%feature("nothreadallow", "0") GAUSS::getSymbolType;
+%feature("nothreadallow", "0") GAUSS::getScalar;
+%feature("nothreadallow", "0") GAUSS::getMatrix;
+%feature("nothreadallow", "0") GAUSS::getMatrixAndClear;
+%feature("nothreadallow", "0") GAUSS::getArray;
+%feature("nothreadallow", "0") GAUSS::getArrayAndClear;
+%feature("nothreadallow", "0") GAUSS::getString;
+%feature("nothreadallow", "0") GAUSS::getStringArray;
+%feature("nothreadallow", "0") GAUSS::getSymbol;
+%feature("nothreadallow", "0") GAUSS::getSymbols;
+%feature("nothreadallow", "0") GAUSS::getMatrixDirect;
+%feature("nothreadallow", "0") GAUSS::getMatrixView;
+%feature("nothreadallow", "0") GAUSS::setSymbol;
+%feature("nothreadallow", "0") GAUSS::setSymbols;
+%feature("nothreadallow", "0") GAUSS::setScalar;
+%feature("nothreadallow", "0") GAUSS::_setSymbol;
+%feature("nothreadallow", "0") GAUSS::moveSymbol;
+%feature("nothreadallow", "0") GAUSS::moveMatrix;
+%feature("nothreadallow", "0") GEMatrix::getData;
+%feature("nothreadallow", "0") GEMatrix::getImagData;
+%feature("nothreadallow", "0") GEArray::getData;
+%feature("nothreadallow", "0") GEArray::getImagData;
+%feature("nothreadallow", "0") GEArraySlice::toArray;
+%feature("nothreadallow", "0") GEWorkspacePool::setSize;
+%feature("nothreadallow", "0") GEWorkspacePool::acquire;
+%feature("nothreadallow", "0") GEWorkspacePool::release;
 #endif
 
 #ifdef SWIGWIN
@@ -35,6 +99,7 @@ namespace std {
 %include "arrays_csharp.i"
 %apply double INPUT[] {const double *data}
 %apply double INPUT[] {const double *imag_data}
+%apply double INPUT[] {const double *interleaved_data}
 %apply int INPUT[] {int *orders}
 #endif
 
@@ -42,6 +107,7 @@ namespace std {
 %include "arrays_javascript.i"
 %apply double[] {const double *data}
 %apply double[] {const double *imag_data}
+%apply double[] {const double *interleaved_data}
 %apply int[] {int *orders}
 
 %typemap(in) const std::vector<double> & {
@@ -219,13 +285,24 @@ JAVASCRIPT_OUT_FIXED_ARRAY(ArrayOwner, v8::ArrayBufferCreationMode::kInternalize
  /* Includes the header in the wrapper code */
  #include "src/gauss.h"
  #include "src/gesymbol.h"
+ #include "src/gearrayslice.h"
  #include "src/gearray.h"
  #include "src/gematrix.h"
+ #include "src/gematrixview.h"
  #include "src/gestringarray.h"
  #include "src/geworkspace.h"
+ #include "src/geprogramcache.h"
+ #include "src/geproccall.h"
+ #include "src/gecancellationtoken.h"
+ #include "src/gemappedfile.h"
+ #include "src/geprofile.h"
+ #include "src/gebatchresult.h"
+ #include "src/geworkspacepool.h"
+ #include "src/geworkspacesnapshot.h"
  #include "src/workspacemanager.h"
  #include "src/gefuncwrapper.h"
  #include "src/gesymtype.h"
+ #include "src/gelayout.h"
 %}
 
 #ifdef SWIGCSHARP
@@ -246,16 +323,24 @@ public int this[int key]
 
 %newobject GAUSS::getSymbol;
 %factory(GESymbol *GAUSS::getSymbol, GEMatrix, GEArray, GEStringArray);
+%factory(GESymbol *GEProcCall::getReturn, GEMatrix, GEArray, GEStringArray);
+%newobject GAUSS::evaluate;
+%factory(GESymbol *GAUSS::evaluate, GEMatrix, GEArray, GEStringArray);
 
 #ifndef SWIGPHP
 %newobject GAUSS::getMatrixDirect;
+%newobject GAUSS::getMatrixView;
 %newobject GAUSS::getMatrix;
 %newobject GAUSS::getMatrixAndClear;
 %newobject GAUSS::getArray;
 %newobject GAUSS::getArrayAndClear;
 %newobject GAUSS::getStringArray;
 %newobject GEArray::getPlane;
+%newobject GEArraySlice::toArray;
 %newobject GAUSS::loadWorkspace;
+%newobject GAUSS::profileProgram;
+%newobject GAUSS::executeBatch;
+%newobject GAUSS::snapshotWorkspace;
 /*%newobject GAUSS::createWorkspace;*/
 #endif
 %delobject GAUSS::destroyWorkspace;
@@ -310,6 +395,24 @@ class GEIterator:
 ARRAYHELPER(double, GEMatrix)
 ARRAYHELPER(std::string, GEStringArray)
 
+%extend GEMatrixView {
+    std::string __str__() {
+        return $self->toString();
+    }
+
+    int __len__() {
+        return $self->size();
+    }
+
+    double __getitem__(int i)
+    {return $self->getElement(i);}
+
+  %pythoncode %{
+    def __iter__(self):
+        return GEIterator(self)
+  %}
+}
+
 %rename(__getitem__) doubleArray::getitem;
 %rename(__setitem__) doubleArray::setitem;
 %rename(__len__) doubleArray::size;
@@ -321,6 +424,813 @@ ARRAYHELPER(std::string, GEStringArray)
 %}
 }
 
+/*
+ * Buffer protocol (PEP 3118) support. Python proxy classes cannot implement
+ * bf_getbuffer directly, so each supported type hands out a memoryview over a
+ * small exporter object that references the C++ data and keeps the owning
+ * proxy alive. Complex data is exposed with a leading axis of length 2,
+ * matching the GAUSS layout of all real values followed by all imaginary values.
+ */
+%{
+#include <vector>
+
+struct GEBufferDesc {
+    GEBufferDesc() : buf(NULL), readonly(false), format("d"), itemsize(sizeof(double)), owned(false) {}
+
+    double *buf;
+    std::vector<Py_ssize_t> shape;
+    std::vector<Py_ssize_t> strides;    /* C-contiguous when empty */
+    bool readonly;
+    const char *format;
+    Py_ssize_t itemsize;
+    bool owned;         /* buf was allocated with PyMem_Malloc and belongs to the exporter */
+};
+
+typedef struct {
+    PyObject_HEAD
+    PyObject *owner;
+    double *buf;
+    int owned;
+    const char *format;
+    Py_ssize_t itemsize;
+    int ndim;
+    int readonly;
+    Py_ssize_t len;
+    Py_ssize_t *shape;
+    Py_ssize_t *strides;
+    int contiguous;     /* strides are C-contiguous */
+} GEBufferExporter;
+
+static double GEBufferEmpty = 0.0;
+
+static int GEBufferExporter_getbuffer(PyObject *obj, Py_buffer *view, int flags) {
+    GEBufferExporter *self = (GEBufferExporter*)obj;
+
+    if ((flags & PyBUF_WRITABLE) && self->readonly) {
+        PyErr_SetString(PyExc_BufferError, "Object is not writable.");
+        view->obj = NULL;
+        return -1;
+    }
+
+    if ((flags & PyBUF_STRIDES) != PyBUF_STRIDES && !self->contiguous) {
+        PyErr_SetString(PyExc_BufferError, "Object is not C-contiguous.");
+        view->obj = NULL;
+        return -1;
+    }
+
+    view->obj = obj;
+    Py_INCREF(obj);
+    view->buf = self->buf;
+    view->len = self->len;
+    view->readonly = self->readonly;
+    view->itemsize = self->itemsize;
+    view->format = (flags & PyBUF_FORMAT) ? (char*)self->format : NULL;
+    view->ndim = self->ndim;
+    view->shape = (flags & PyBUF_ND) ? self->shape : NULL;
+    view->strides = ((flags & PyBUF_STRIDES) == PyBUF_STRIDES) ? self->strides : NULL;
+    view->suboffsets = NULL;
+    view->internal = NULL;
+
+    return 0;
+}
+
+static void GEBufferExporter_dealloc(PyObject *obj) {
+    GEBufferExporter *self = (GEBufferExporter*)obj;
+    Py_XDECREF(self->owner);
+    PyMem_Free(self->shape);
+
+    if (self->owned)
+        PyMem_Free(self->buf);
+
+    PyObject_Del(obj);
+}
+
+static PyBufferProcs GEBufferExporter_as_buffer;
+static PyTypeObject GEBufferExporter_Type = { PyVarObject_HEAD_INIT(NULL, 0) };
+
+static int GE_readyBufferExporter() {
+    if (GEBufferExporter_Type.tp_flags & Py_TPFLAGS_READY)
+        return 0;
+
+    GEBufferExporter_as_buffer.bf_getbuffer = GEBufferExporter_getbuffer;
+    GEBufferExporter_as_buffer.bf_releasebuffer = NULL;
+
+    GEBufferExporter_Type.tp_name = "GEBufferExporter";
+    GEBufferExporter_Type.tp_basicsize = sizeof(GEBufferExporter);
+    GEBufferExporter_Type.tp_dealloc = GEBufferExporter_dealloc;
+    GEBufferExporter_Type.tp_as_buffer = &GEBufferExporter_as_buffer;
+    GEBufferExporter_Type.tp_flags = Py_TPFLAGS_DEFAULT;
+#if PY_MAJOR_VERSION < 3
+    GEBufferExporter_Type.tp_flags |= Py_TPFLAGS_HAVE_NEWBUFFER;
+#endif
+
+    return PyType_Ready(&GEBufferExporter_Type);
+}
+
+/*
+ * Returns a memoryview over the described data, keeping owner (if any) alive for its lifetime.
+ * Takes ownership of desc.buf when desc.owned is set, even on failure.
+ */
+static PyObject* GE_newBuffer(PyObject *owner, const GEBufferDesc &desc) {
+    GEBufferExporter *self = NULL;
+
+    if (GE_readyBufferExporter() < 0 || !(self = PyObject_New(GEBufferExporter, &GEBufferExporter_Type))) {
+        if (desc.owned)
+            PyMem_Free(desc.buf);
+
+        return NULL;
+    }
+
+    self->owner = owner;
+    Py_XINCREF(owner);
+    self->buf = desc.buf ? desc.buf : &GEBufferEmpty;
+    self->owned = desc.owned && desc.buf;
+    self->format = desc.format;
+    self->itemsize = desc.itemsize;
+    self->readonly = desc.readonly;
+    self->contiguous = desc.strides.empty();
+    self->ndim = (int)desc.shape.size();
+    self->shape = (Py_ssize_t*)PyMem_Malloc(2 * self->ndim * sizeof(Py_ssize_t) + 1);
+    self->strides = self->shape + self->ndim;
+
+    if (!self->shape) {
+        Py_DECREF(self);
+        return PyErr_NoMemory();
+    }
+
+    Py_ssize_t stride = desc.itemsize;
+
+    for (int i = self->ndim - 1; i >= 0; --i) {
+        self->shape[i] = desc.shape[i];
+        self->strides[i] = desc.strides.empty() ? stride : desc.strides[i];
+        stride *= desc.shape[i];
+    }
+
+    self->len = stride;
+
+    PyObject *ret = PyMemoryView_FromObject((PyObject*)self);
+    Py_DECREF(self);
+
+    return ret;
+}
+
+/* Returns a numpy __array_interface__ dictionary for the described data. */
+static PyObject* GE_arrayInterface(const GEBufferDesc &desc) {
+    const int one = 1;
+    const char *typestr = *(const char*)&one ? "<f8" : ">f8";
+
+    PyObject *shape = PyTuple_New(desc.shape.size());
+
+    if (!shape)
+        return NULL;
+
+    for (size_t i = 0; i < desc.shape.size(); ++i)
+        PyTuple_SET_ITEM(shape, i, PyLong_FromSsize_t(desc.shape[i]));
+
+    void *buf = desc.buf ? desc.buf : &GEBufferEmpty;
+
+    PyObject *ret = Py_BuildValue("{s:i,s:N,s:s,s:(N,O)}",
+                                  "version", 3,
+                                  "shape", shape,
+                                  "typestr", typestr,
+                                  "data", PyLong_FromVoidPtr(buf), desc.readonly ? Py_True : Py_False);
+
+    if (ret && !desc.strides.empty()) {
+        PyObject *strides = PyTuple_New(desc.strides.size());
+
+        for (size_t i = 0; strides && i < desc.strides.size(); ++i)
+            PyTuple_SET_ITEM(strides, i, PyLong_FromSsize_t(desc.strides[i]));
+
+        if (!strides || PyDict_SetItemString(ret, "strides", strides) < 0)
+            Py_CLEAR(ret);
+
+        Py_XDECREF(strides);
+    }
+
+    return ret;
+}
+
+static GEBufferDesc GE_describeBuffer(GEMatrix *m) {
+    GEBufferDesc desc;
+    desc.buf = m->data();
+
+    if (m->isComplex())
+        desc.shape.push_back(2);
+
+    desc.shape.push_back(m->getRows());
+    desc.shape.push_back(m->getCols());
+
+    return desc;
+}
+
+static GEBufferDesc GE_describeBuffer(GEArray *a) {
+    GEBufferDesc desc;
+    desc.buf = a->data();
+
+    if (a->isComplex())
+        desc.shape.push_back(2);
+
+    std::vector<int> orders = a->getOrders();
+    desc.shape.insert(desc.shape.end(), orders.begin(), orders.end());
+
+    return desc;
+}
+
+/* Slices are described in place with their strides, and are read-only. */
+static GEBufferDesc GE_describeBuffer(GEArraySlice *s) {
+    GEBufferDesc desc;
+    desc.buf = const_cast<double*>(s->data());
+    desc.readonly = true;
+
+    if (!desc.buf) {
+        desc.shape.push_back(0);
+        return desc;
+    }
+
+    if (s->isComplex()) {
+        desc.shape.push_back(2);
+        desc.strides.push_back((Py_ssize_t)(s->data(true) - s->data()) * sizeof(double));
+    }
+
+    std::vector<int> orders = s->getOrders();
+    std::vector<int> strides = s->getStrides();
+
+    for (size_t i = 0; i < orders.size(); ++i) {
+        desc.shape.push_back(orders[i]);
+        desc.strides.push_back((Py_ssize_t)strides[i] * (Py_ssize_t)sizeof(double));
+    }
+
+    return desc;
+}
+
+static GEBufferDesc GE_describeBuffer(doubleArray *d) {
+    GEBufferDesc desc;
+    desc.buf = d->data();
+    desc.shape.push_back(d->data() ? d->rows() : 0);
+    desc.shape.push_back(d->data() ? d->cols() : 0);
+
+    return desc;
+}
+
+/* Describes a new complex128 ('Zd') buffer holding an interleaved copy of the data. */
+template<typename T>
+static bool GE_describeInterleaved(T *sym, GEBufferDesc &desc, const std::vector<Py_ssize_t> &shape) {
+    size_t elements = sym->size();
+
+    desc.buf = (double*)PyMem_Malloc(2 * elements * sizeof(double) + 1);
+
+    if (!desc.buf) {
+        PyErr_NoMemory();
+        return false;
+    }
+
+    desc.owned = true;
+    desc.format = "Zd";
+    desc.itemsize = 2 * sizeof(double);
+    desc.shape = shape;
+
+    if (!sym->getInterleavedData(desc.buf, 2 * elements)) {
+        PyMem_Free(desc.buf);
+        PyErr_SetString(PyExc_RuntimeError, "Unable to read symbol data.");
+        return false;
+    }
+
+    return true;
+}
+
+static PyObject* GE_interleavedBuffer(GEMatrix *m) {
+    GEBufferDesc desc;
+    std::vector<Py_ssize_t> shape;
+    shape.push_back(m->getRows());
+    shape.push_back(m->getCols());
+
+    if (!GE_describeInterleaved(m, desc, shape))
+        return NULL;
+
+    return GE_newBuffer(NULL, desc);
+}
+
+static PyObject* GE_interleavedBuffer(GEArray *a) {
+    GEBufferDesc desc;
+    std::vector<int> orders = a->getOrders();
+
+    if (!GE_describeInterleaved(a, desc, std::vector<Py_ssize_t>(orders.begin(), orders.end())))
+        return NULL;
+
+    return GE_newBuffer(NULL, desc);
+}
+%}
+
+%inline %{
+PyObject* _geInterleavedBuffer(GEMatrix *m) { return GE_interleavedBuffer(m); }
+PyObject* _geInterleavedBuffer(GEArray *a) { return GE_interleavedBuffer(a); }
+PyObject* _geBuffer(PyObject *owner, GEMatrix *m) { return GE_newBuffer(owner, GE_describeBuffer(m)); }
+PyObject* _geBuffer(PyObject *owner, GEArray *a) { return GE_newBuffer(owner, GE_describeBuffer(a)); }
+PyObject* _geBuffer(PyObject *owner, doubleArray *d) { return GE_newBuffer(owner, GE_describeBuffer(d)); }
+PyObject* _geBuffer(PyObject *owner, GEArraySlice *s) { return GE_newBuffer(owner, GE_describeBuffer(s)); }
+PyObject* _geArrayInterface(GEMatrix *m) { return GE_arrayInterface(GE_describeBuffer(m)); }
+PyObject* _geArrayInterface(GEArray *a) { return GE_arrayInterface(GE_describeBuffer(a)); }
+PyObject* _geArrayInterface(doubleArray *d) { return GE_arrayInterface(GE_describeBuffer(d)); }
+PyObject* _geArrayInterface(GEArraySlice *s) { return GE_arrayInterface(GE_describeBuffer(s)); }
+%}
+
+/*
+ * getBuffer() returns a writable memoryview over the object data, and numpy.asarray()
+ * returns a view through __array_interface__, without copying. The view shares the
+ * object memory, and is only valid until the object is cleared or resized.
+ */
+%define BUFFERHELPER(name)
+%extend name {
+  %pythoncode %{
+    def getBuffer(self):
+        return _geBuffer(self, self)
+
+    def __buffer__(self, flags):
+        return _geBuffer(self, self)
+
+    @property
+    def __array_interface__(self):
+        return _geArrayInterface(self)
+  %}
+}
+%enddef
+
+BUFFERHELPER(GEMatrix)
+BUFFERHELPER(GEArray)
+BUFFERHELPER(doubleArray)
+BUFFERHELPER(GEArraySlice)
+
+/* A slice references the array data, so keep the array alive for as long as the slice. */
+%pythonappend GEArray::slice %{
+    val._array = self
+%}
+
+/* Return values are owned by the call object, so keep it alive for as long as they are used. */
+%pythonappend GEProcCall::getReturn %{
+    if val is not None:
+        val._call = self
+%}
+
+/*
+ * getInterleavedBuffer() returns a complex128 ('Zd') memoryview over an interleaved copy of
+ * the data, which numpy.asarray() accepts as a complex array.
+ */
+%define INTERLEAVEDHELPER(name)
+%extend name {
+  %pythoncode %{
+    def getInterleavedBuffer(self):
+        return _geInterleavedBuffer(self)
+  %}
+}
+%enddef
+
+INTERLEAVEDHELPER(GEMatrix)
+INTERLEAVEDHELPER(GEArray)
+
+/*
+ * Buffer import. Any C-contiguous buffer of doubles is passed to the
+ * (data, rows, cols, is_complex) overloads without an intermediate copy.
+ * Interleaved complex ('Zd') buffers, such as numpy complex128, are split
+ * into a temporary copy first.
+ */
+%{
+#include <climits>
+#include <cstring>
+#include "src/gekernels.h"
+
+struct GEBufferArg {
+    Py_buffer view;
+    double *data;
+    std::vector<double> split;  /* split copy of interleaved complex input */
+
+    GEBufferArg() : data(NULL) { view.obj = NULL; }
+    ~GEBufferArg() { if (view.obj) PyBuffer_Release(&view); }
+};
+
+/* Returns 'd' for double, 'Z' for complex double, or 0 for any other struct format. */
+static char GE_formatCode(const char *format) {
+    const int one = 1;
+    const bool little = (*(const char*)&one != 0);
+
+    if (!format)
+        return 0;
+
+    if (*format == '@' || *format == '=' || (*format == '<' && little) || (*format == '>' && !little) || (*format == '!' && !little))
+        ++format;
+
+    if (strcmp(format, "d") == 0)
+        return 'd';
+    else if (strcmp(format, "Zd") == 0)
+        return 'Z';
+
+    return 0;
+}
+
+/* Acquire a contiguous buffer of double or complex double values from obj. Sets a Python error on failure. */
+static char GE_acquireBuffer(PyObject *obj, GEBufferArg &arg, int flags = PyBUF_C_CONTIGUOUS) {
+    if (!PyObject_CheckBuffer(obj) || PyObject_GetBuffer(obj, &arg.view, flags | PyBUF_FORMAT) < 0) {
+        if (!PyErr_Occurred() || PyErr_ExceptionMatches(PyExc_BufferError)) {
+            PyErr_Clear();
+            PyErr_SetString(PyExc_TypeError, flags == PyBUF_C_CONTIGUOUS ?
+                            "Expected a C-contiguous buffer of double precision values." :
+                            "Expected a contiguous buffer of double precision values.");
+        }
+
+        arg.view.obj = NULL;
+        return 0;
+    }
+
+    char code = GE_formatCode(arg.view.format);
+
+    if ((code == 'd' && arg.view.itemsize != sizeof(double)) || (code == 'Z' && arg.view.itemsize != 2 * sizeof(double)))
+        code = 0;
+
+    if (!code)
+        PyErr_SetString(PyExc_TypeError, "Buffer must contain double precision values.");
+
+    arg.data = static_cast<double*>(arg.view.buf);
+
+    return code;
+}
+
+/*
+ * Acquire a matrix buffer from obj and derive its shape. Split complex data is given as a
+ * leading dimension of 2, interleaved complex ('Zd') data is split into a temporary copy.
+ * If layout is given, Fortran-contiguous buffers are accepted as well and reported as GELayout::COL_MAJOR.
+ */
+static bool GE_getMatrixBuffer(PyObject *obj, GEBufferArg &arg, int *rows, int *cols, bool *complex, int *layout = NULL) {
+    char code = GE_acquireBuffer(obj, arg, layout ? PyBUF_ANY_CONTIGUOUS : PyBUF_C_CONTIGUOUS);
+
+    if (!code)
+        return false;
+
+    if (layout) {
+        *layout = PyBuffer_IsContiguous(&arg.view, 'C') ? GELayout::ROW_MAJOR : GELayout::COL_MAJOR;
+
+        if (*layout == GELayout::COL_MAJOR && code == 'd' && arg.view.ndim > 2) {
+            PyErr_SetString(PyExc_ValueError, "Split complex data must be C-contiguous.");
+            return false;
+        }
+    }
+
+    const Py_buffer &v = arg.view;
+    Py_ssize_t r = 1, c = 1;
+    *complex = (code == 'Z');
+
+    if (v.ndim == 1) {
+        c = v.shape[0];
+    } else if (v.ndim == 2) {
+        r = v.shape[0];
+        c = v.shape[1];
+    } else if (v.ndim == 3 && v.shape[0] == 2 && code == 'd') {
+        r = v.shape[1];
+        c = v.shape[2];
+        *complex = true;
+    } else if (v.ndim != 0) {
+        PyErr_SetString(PyExc_ValueError, "Buffer must have 1 or 2 dimensions, or 3 dimensions with a leading dimension of 2 for complex data.");
+        return false;
+    }
+
+    if (r < 1 || c < 1 || r > INT_MAX || c > INT_MAX) {
+        PyErr_SetString(PyExc_ValueError, "Buffer dimensions are out of range.");
+        return false;
+    }
+
+    *rows = (int)r;
+    *cols = (int)c;
+
+    if (code == 'Z') {
+        size_t elements = (size_t)r * c;
+        arg.split.resize(2 * elements);
+        splitComplex(arg.data, arg.split.data(), arg.split.data() + elements, elements);
+        arg.data = arg.split.data();
+    }
+
+    return true;
+}
+
+/* Acquire a buffer of interleaved complex values, either as 'Zd' or pairs of doubles. */
+static bool GE_getInterleavedBuffer(PyObject *obj, GEBufferArg &arg, size_t *len) {
+    char code = GE_acquireBuffer(obj, arg);
+
+    if (!code)
+        return false;
+
+    *len = arg.view.len / sizeof(double);
+
+    return true;
+}
+%}
+
+%typemap(in) (const double *data, int rows, int cols, bool is_complex) (GEBufferArg buffer) {
+    if (!GE_getMatrixBuffer($input, buffer, &$2, &$3, &$4))
+        SWIG_fail;
+
+    $1 = buffer.data;
+}
+
+%typemap(typecheck, precedence=SWIG_TYPECHECK_DOUBLE_ARRAY) (const double *data, int rows, int cols, bool is_complex) {
+    $1 = PyObject_CheckBuffer($input) ? 1 : 0;
+}
+
+/* The layout is taken from the buffer, so this overload replaces the row-major only one in Python. */
+%ignore GAUSS::setSymbol(const double *data, int rows, int cols, bool is_complex, std::string name);
+%ignore GAUSS::setSymbol(const double *data, int rows, int cols, bool is_complex, std::string name, GEWorkspace *workspace);
+
+%typemap(in) (const double *data, int rows, int cols, bool is_complex, int layout) (GEBufferArg buffer) {
+    if (!GE_getMatrixBuffer($input, buffer, &$2, &$3, &$4, &$5))
+        SWIG_fail;
+
+    $1 = buffer.data;
+}
+
+%typemap(typecheck, precedence=SWIG_TYPECHECK_DOUBLE_ARRAY) (const double *data, int rows, int cols, bool is_complex, int layout) {
+    $1 = PyObject_CheckBuffer($input) ? 1 : 0;
+}
+
+/* Copy a matrix into a new buffer in the requested layout, returned as a memoryview */
+%ignore GAUSS::getMatrixData(std::string name, double *dest, size_t dest_len, int layout) const;
+%ignore GAUSS::getMatrixData(std::string name, double *dest, size_t dest_len, int layout, GEWorkspace *workspace) const;
+
+%extend GAUSS {
+    PyObject* getMatrixData(std::string name, int layout = GELayout::ROW_MAJOR, GEWorkspace *workspace = 0) {
+        if (!workspace)
+            workspace = $self->getActiveWorkspace();
+
+        // Size the buffer from the same lookup the data is copied from
+        GAUSS_MatrixInfo_t info;
+        bool allocated = false;
+
+        GEBufferDesc desc;
+        desc.owned = true;
+
+        bool ok = $self->getMatrixData(name, layout, workspace, [&](const GAUSS_MatrixInfo_t &i) -> double* {
+            info = i;
+            allocated = true;
+            desc.buf = (double*)PyMem_Malloc((size_t)i.rows * i.cols * (i.complex ? 2 : 1) * sizeof(double));
+            return desc.buf;
+        });
+
+        if (!ok) {
+            PyMem_Free(desc.buf);
+
+            if (allocated && !desc.buf)
+                return PyErr_NoMemory();
+
+            Py_RETURN_NONE;
+        }
+
+        const Py_ssize_t rows = info.rows;
+        const Py_ssize_t cols = info.cols;
+
+        const Py_ssize_t item = sizeof(double);
+
+        if (info.complex) {
+            desc.shape.push_back(2);
+            desc.strides.push_back(rows * cols * item);
+        }
+
+        desc.shape.push_back(rows);
+        desc.shape.push_back(cols);
+
+        if (layout == GELayout::COL_MAJOR) {
+            desc.strides.push_back(item);
+            desc.strides.push_back(rows * item);
+        } else {
+            desc.strides.push_back(cols * item);
+            desc.strides.push_back(item);
+        }
+
+        return GE_newBuffer(NULL, desc);
+    }
+}
+
+%typemap(in) (const double *interleaved_data, size_t interleaved_len) (GEBufferArg buffer) {
+    if (!GE_getInterleavedBuffer($input, buffer, &$2))
+        SWIG_fail;
+
+    $1 = buffer.data;
+}
+
+%typemap(typecheck, precedence=SWIG_TYPECHECK_DOUBLE_ARRAY) (const double *interleaved_data, size_t interleaved_len) {
+    $1 = PyObject_CheckBuffer($input) ? 1 : 0;
+}
+
+/* Compiled programs are read from any bytes-like object. GAUSS::loadCompiledBuffer() copies the
+   data before the engine sees it, so immutable objects such as bytes are safe. */
+%typemap(in) (const char *buffer, size_t size) (GEBufferArg arg) {
+    if (!PyObject_CheckBuffer($input) || PyObject_GetBuffer($input, &arg.view, PyBUF_SIMPLE) < 0) {
+        arg.view.obj = NULL;
+
+        if (!PyErr_Occurred() || PyErr_ExceptionMatches(PyExc_BufferError)) {
+            PyErr_Clear();
+            PyErr_SetString(PyExc_TypeError, "Expected a bytes-like object.");
+        }
+
+        SWIG_fail;
+    }
+
+    $1 = static_cast<const char*>(arg.view.buf);
+    $2 = arg.view.len;
+}
+
+%typemap(typecheck, precedence=SWIG_TYPECHECK_STRING) (const char *buffer, size_t size) {
+    $1 = PyObject_CheckBuffer($input) ? 1 : 0;
+}
+
+/*
+ * getSymbols() returns a dict of name to symbol, with each symbol wrapped as its concrete
+ * type and owned by Python. setSymbols() accepts a dict of name to GEMatrix, GEArray or
+ * GEStringArray.
+ */
+%typemap(out) std::map<std::string, GESymbol*> {
+    $result = PyDict_New();
+
+    for (std::map<std::string, GESymbol*>::iterator it = $1.begin(); it != $1.end(); ++it) {
+        GESymbol *symbol = it->second;
+        swig_type_info *desc = NULL;
+
+        switch (symbol->type()) {
+        case GESymType::SCALAR:
+        case GESymType::MATRIX:
+            desc = $descriptor(GEMatrix*);
+            break;
+        case GESymType::ARRAY_GAUSS:
+            desc = $descriptor(GEArray*);
+            break;
+        default:
+            desc = $descriptor(GEStringArray*);
+            break;
+        }
+
+        // Every symbol is handed to Python, even after a failure, so that it gets freed
+        PyObject *key = SWIG_From_std_string(it->first);
+        PyObject *value = SWIG_NewPointerObj(SWIG_as_voidptr(symbol), desc, SWIG_POINTER_OWN);
+
+        if (!$result || !key || !value || PyDict_SetItem($result, key, value) < 0)
+            Py_CLEAR($result);
+
+        Py_XDECREF(key);
+        Py_XDECREF(value);
+    }
+
+    if (!$result)
+        SWIG_fail;
+}
+
+%typemap(in) const std::map<std::string, GESymbol*> & (std::map<std::string, GESymbol*> temp) {
+    if (!PyDict_Check($input)) {
+        SWIG_exception_fail(SWIG_TypeError, "in method '$symname', expected a dict of name to GESymbol");
+    }
+
+    PyObject *key, *value;
+    Py_ssize_t pos = 0;
+
+    while (PyDict_Next($input, &pos, &key, &value)) {
+        std::string *name = NULL;
+        void *symbol = NULL;
+        int res = SWIG_AsPtr_std_string(key, &name);
+
+        if (!SWIG_IsOK(res) || !name) {
+            SWIG_exception_fail(SWIG_TypeError, "in method '$symname', symbol names must be strings");
+        }
+
+        std::string tmpName = *name;
+
+        if (SWIG_IsNewObj(res))
+            delete name;
+
+        if (!SWIG_IsOK(SWIG_ConvertPtr(value, &symbol, $descriptor(GESymbol*), 0))) {
+            SWIG_exception_fail(SWIG_TypeError, "in method '$symname', symbol values must be GEMatrix, GEArray or GEStringArray");
+        }
+
+        temp[tmpName] = reinterpret_cast<GESymbol*>(symbol);
+    }
+
+    $1 = &temp;
+}
+
+%typemap(typecheck) const std::map<std::string, GESymbol*> & {
+    $1 = PyDict_Check($input) ? 1 : 0;
+}
+
+/* executeBatch() accepts any sequence of program handles */
+%typemap(in) const std::vector<ProgramHandle_t*> & (std::vector<ProgramHandle_t*> temp) {
+    if (!PySequence_Check($input)) {
+        PyErr_SetString(PyExc_TypeError, "Expected a sequence of program handles.");
+        SWIG_fail;
+    }
+
+    Py_ssize_t count = PySequence_Size($input);
+    temp.reserve(count);
+
+    for (Py_ssize_t i = 0; i < count; ++i) {
+        PyObject *item = PySequence_GetItem($input, i);
+        void *ph = 0;
+        int res = SWIG_ConvertPtr(item, &ph, $descriptor(ProgramHandle_t*), 0);
+        Py_XDECREF(item);
+
+        if (!SWIG_IsOK(res)) {
+            PyErr_SetString(PyExc_TypeError, "Expected a sequence of program handles.");
+            SWIG_fail;
+        }
+
+        temp.push_back(static_cast<ProgramHandle_t*>(ph));
+    }
+
+    $1 = &temp;
+}
+
+%typemap(typecheck, precedence=SWIG_TYPECHECK_POINTER) const std::vector<ProgramHandle_t*> & {
+    $1 = 0;
+
+    if (PySequence_Check($input) && !PyUnicode_Check($input) && !PyBytes_Check($input)) {
+        $1 = 1;
+        Py_ssize_t count = PySequence_Size($input);
+
+        for (Py_ssize_t i = 0; i < count && $1; ++i) {
+            PyObject *item = PySequence_GetItem($input, i);
+            void *ph = 0;
+            $1 = SWIG_IsOK(SWIG_ConvertPtr(item, &ph, $descriptor(ProgramHandle_t*), 0)) ? 1 : 0;
+            Py_XDECREF(item);
+        }
+    }
+}
+
+%{
+/*
+ * Wrap a Python callable for the asynchronous methods. The job calls it exactly once, usually on a
+ * worker thread, so it takes the GIL for the call and drops its reference afterwards.
+ */
+static std::function<void(bool)> GEPyBoolCallback(PyObject *callable) {
+    if (!callable || callable == Py_None)
+        return std::function<void(bool)>();
+
+    Py_INCREF(callable);
+
+    return [callable](bool success) {
+        PyGILState_STATE state = PyGILState_Ensure();
+        PyObject *ret = PyObject_CallFunctionObjArgs(callable, success ? Py_True : Py_False, NULL);
+
+        if (ret)
+            Py_DECREF(ret);
+        else
+            PyErr_WriteUnraisable(callable);
+
+        Py_DECREF(callable);
+        PyGILState_Release(state);
+    };
+}
+
+static std::function<void(GEMatrix*)> GEPyMatrixCallback(PyObject *callable) {
+    if (!callable || callable == Py_None)
+        return std::function<void(GEMatrix*)>();
+
+    Py_INCREF(callable);
+
+    return [callable](GEMatrix *matrix) {
+        PyGILState_STATE state = PyGILState_Ensure();
+        PyObject *arg = matrix ? SWIG_NewPointerObj(SWIG_as_voidptr(matrix), SWIGTYPE_p_GEMatrix, SWIG_POINTER_OWN) : Py_None;
+
+        if (!matrix)
+            Py_INCREF(arg);
+
+        PyObject *ret = PyObject_CallFunctionObjArgs(callable, arg, NULL);
+
+        if (ret)
+            Py_DECREF(ret);
+        else
+            PyErr_WriteUnraisable(callable);
+
+        Py_DECREF(arg);
+        Py_DECREF(callable);
+        PyGILState_Release(state);
+    };
+}
+%}
+
+/*
+ * Callback versions of executeString, executeProgram and getMatrix. The callback is called with the
+ * result on a worker thread; jobs for the same workspace run in the order they were started.
+ *
+ *   ge.executeStringAsync("x = inv(rndn(500, 500))", wh, lambda ok: print(ok))
+ *   ge.getMatrixAsync("x", wh, lambda x: print(x.getRows()))
+ *   ge.waitForAsync(wh)
+ */
+%extend GAUSS {
+    void executeStringAsync(std::string code, GEWorkspace *workspace = 0, PyObject *callback = 0) {
+        $self->executeStringAsync(code, workspace ? workspace : $self->getActiveWorkspace(), GEPyBoolCallback(callback));
+    }
+
+    void executeProgramAsync(ProgramHandle_t *programHandle, GEWorkspace *workspace = 0, PyObject *callback = 0) {
+        $self->executeProgramAsync(programHandle, workspace ? workspace : $self->getActiveWorkspace(), GEPyBoolCallback(callback));
+    }
+
+    void getMatrixAsync(std::string name, GEWorkspace *workspace = 0, PyObject *callback = 0) {
+        $self->getMatrixAsync(name, workspace ? workspace : $self->getActiveWorkspace(), GEPyMatrixCallback(callback));
+    }
+}
+
 %factory(GESymbol *GAUSS::__getitem__, GEMatrix, GEArray, GEStringArray);
 %extend GAUSS {
     GESymbol* __getitem__(char *name)
@@ -376,6 +1286,12 @@ CB_THISOWN(IGEProgramInputCheck, 0)
     }
 };
 
+%extend GEMatrixView {
+    std::string __toString() {
+        return $self->toString();
+    }
+};
+
 %factory(GESymbol *GAUSS::offsetGet, GEMatrix, GEArray, GEStringArray);
 %typemap("phpinterfaces") GAUSS "ArrayAccess";
 %extend GAUSS {
@@ -751,11 +1667,154 @@ ARRAYHELPER(std::string, GEStringArray, "")
 
 /* End PHP Only*/
 
+/* Start JavaScript only*/
+#ifdef SWIGJAVASCRIPT
+
+%{
+#include <uv.h>
+
+/* A promise returned to JavaScript from an asynchronous method */
+struct GEJSPromise {
+    v8::Local<v8::Value> value;
+};
+
+/*
+ * Jobs run on the GAUSS worker pool, which runs the jobs of one workspace one at a time and in
+ * order. The worker only signals the uv_async_t; the promise is settled on the event loop thread.
+ */
+class GEJSAsyncJob {
+public:
+    GEJSAsyncJob(bool returnsMatrix) : isolate_(v8::Isolate::GetCurrent()), returnsMatrix_(returnsMatrix), success_(false), matrix_(0) {
+        v8::Local<v8::Context> context = isolate_->GetCurrentContext();
+        v8::Local<v8::Promise::Resolver> resolver = v8::Promise::Resolver::New(context).ToLocalChecked();
+
+        context_.Reset(isolate_, context);
+        resolver_.Reset(isolate_, resolver);
+
+        uv_async_init(node::GetCurrentEventLoop(isolate_), &handle_, GEJSAsyncJob::complete);
+        handle_.data = this;
+    }
+
+    GEJSPromise promise() {
+        GEJSPromise ret;
+        ret.value = v8::Local<v8::Promise::Resolver>::New(isolate_, resolver_)->GetPromise();
+        return ret;
+    }
+
+    /* Called on a worker thread */
+    void finish(bool success) {
+        success_ = success;
+        uv_async_send(&handle_);
+    }
+
+    void finish(GEMatrix *matrix) {
+        matrix_ = matrix;
+        success_ = (matrix != 0);
+        uv_async_send(&handle_);
+    }
+
+private:
+    static void complete(uv_async_t *handle) {
+        GEJSAsyncJob *job = static_cast<GEJSAsyncJob*>(handle->data);
+        v8::Isolate *isolate = job->isolate_;
+
+        v8::HandleScope scope(isolate);
+        v8::Local<v8::Context> context = v8::Local<v8::Context>::New(isolate, job->context_);
+        v8::Context::Scope contextScope(context);
+
+        {
+            // Runs promise reactions when the scope closes
+            node::CallbackScope callbackScope(isolate, v8::Object::New(isolate), node::async_context());
+
+            v8::Local<v8::Value> value;
+
+            if (!job->returnsMatrix_)
+                value = v8::Boolean::New(isolate, job->success_);
+            else if (job->matrix_)
+                value = SWIG_NewPointerObj(SWIG_as_voidptr(job->matrix_), SWIGTYPE_p_GEMatrix, SWIG_POINTER_OWN);
+            else
+                value = v8::Null(isolate);
+
+            v8::Local<v8::Promise::Resolver>::New(isolate, job->resolver_)->Resolve(context, value).FromJust();
+        }
+
+        uv_close(reinterpret_cast<uv_handle_t*>(&job->handle_), GEJSAsyncJob::destroy);
+    }
+
+    static void destroy(uv_handle_t *handle) {
+        GEJSAsyncJob *job = static_cast<GEJSAsyncJob*>(handle->data);
+        job->resolver_.Reset();
+        job->context_.Reset();
+        delete job;
+    }
+
+    v8::Isolate *isolate_;
+    v8::Persistent<v8::Context> context_;
+    v8::Persistent<v8::Promise::Resolver> resolver_;
+    uv_async_t handle_;
+    bool returnsMatrix_;
+    bool success_;
+    GEMatrix *matrix_;
+};
+%}
+
+%typemap(out) GEJSPromise %{
+    $result = (&$1)->value;
+%}
+
+/*
+ * Promise-returning versions of executeString, executeProgram and getMatrix. The event loop keeps
+ * running while the engine works; jobs for the same workspace still run in the order they were
+ * started.
+ *
+ *   ge.executeStringAsync("x = inv(rndn(500, 500))", wh)
+ *     .then(ok => ge.getMatrixAsync("x", wh))
+ *     .then(x => console.log(x.getRows()));
+ */
+%extend GAUSS {
+    GEJSPromise executeStringAsync(std::string code, GEWorkspace *workspace = 0) {
+        GEJSAsyncJob *job = new GEJSAsyncJob(false);
+        GEJSPromise ret = job->promise();
+
+        $self->executeStringAsync(code, workspace ? workspace : $self->getActiveWorkspace(), [job](bool success) { job->finish(success); });
+
+        return ret;
+    }
+
+    GEJSPromise executeProgramAsync(ProgramHandle_t *programHandle, GEWorkspace *workspace = 0) {
+        GEJSAsyncJob *job = new GEJSAsyncJob(false);
+        GEJSPromise ret = job->promise();
+
+        $self->executeProgramAsync(programHandle, workspace ? workspace : $self->getActiveWorkspace(), [job](bool success) { job->finish(success); });
+
+        return ret;
+    }
+
+    GEJSPromise getMatrixAsync(std::string name, GEWorkspace *workspace = 0) {
+        GEJSAsyncJob *job = new GEJSAsyncJob(true);
+        GEJSPromise ret = job->promise();
+
+        $self->getMatrixAsync(name, workspace ? workspace : $self->getActiveWorkspace(), [job](GEMatrix *matrix) { job->finish(matrix); });
+
+        return ret;
+    }
+}
+
+#endif
+/* End JavaScript only*/
+
 /* Not using this anymore
 %include "gausscarrays.i"
 %array_class(double, doubleArray);
 */
 
+#ifndef SWIGPYTHON
+/* Batched symbol access and execution are only mapped to native containers in Python */
+%ignore GAUSS::getSymbols;
+%ignore GAUSS::setSymbols;
+%ignore GAUSS::executeBatch;
+#endif
+
 /* Ignore stub functions */
 %ignore hookStubOutput;
 %ignore hookStubError;
@@ -775,14 +1834,33 @@ ARRAYHELPER(std::string, GEStringArray, "")
 %ignore GEMatrix::GEMatrix(GAUSS_MatrixInfo_t*);
 %ignore GEMatrix::toInternal();
 
+/* The workspace pool is owned by GAUSS; retrieve it with GAUSS::getWorkspacePool() */
+%nodefaultctor GEWorkspacePool;
+%nodefaultdtor GEWorkspacePool;
+%nodefaultctor GEWorkspaceSnapshot;
+
 /* Parse the header file to generate wrappers */
 %include "src/gauss.h"
 %include "src/gesymbol.h"
+%include "src/gearrayslice.h"
 %include "src/gearray.h"
 %include "src/gematrix.h"
+%include "src/gematrixview.h"
 %include "src/gestringarray.h"
 %include "src/geworkspace.h"
+%include "src/geprogramcache.h"
+%include "src/geproccall.h"
+%include "src/gecancellationtoken.h"
+%include "src/gemappedfile.h"
+%include "src/geprofile.h"
+%include "src/gebatchresult.h"
+%include "src/geworkspacepool.h"
+%include "src/geworkspacesnapshot.h"
 %include "src/workspacemanager.h"
 %include "src/gefuncwrapper.h"
 %include "src/gesymtype.h"
+%include "src/gelayout.h"
 
+namespace std {
+    %template(WorkspaceVector) vector<GEWorkspace*>;
+}
@@ -1,3 +1,7 @@
+#ifdef SWIGPYTHON
+%module(directors="1", threads="1") ge
+#else
 %module(directors="1") ge
+#endif
 %include "gauss.i"
 
@@ -1,3 +1,7 @@
+#ifdef SWIGPYTHON
+%module(directors="1", threads="1") gert
+#else
 %module(directors="1") gert
+#endif
 %include "gauss.i"
 
@@ -16,19 +16,46 @@ HEADERS += $$MTENGHOME/mteng.h \
            $$PWD/src/gauss.h \
            $$PWD/src/gauss_p.h \
            $$PWD/src/gearray.h \
+           $$PWD/src/gearrayslice.h \
+           $$PWD/src/gebatchresult.h \
+           $$PWD/src/gebuffer.h \
+           $$PWD/src/gecancellationtoken.h \
            $$PWD/src/gefuncwrapper.h \
+           $$PWD/src/gekernels.h \
+           $$PWD/src/gelayout.h \
+           $$PWD/src/gemappedfile.h \
            $$PWD/src/gematrix.h \
+           $$PWD/src/gematrixview.h \
+           $$PWD/src/geproccall.h \
+           $$PWD/src/geprofile.h \
+           $$PWD/src/geprogramcache.h \
            $$PWD/src/gestringarray.h \
            $$PWD/src/gesymbol.h \
            $$PWD/src/gesymtype.h \
+           $$PWD/src/geworkerpool.h \
            $$PWD/src/geworkspace.h \
+           $$PWD/src/geworkspacepool.h \
+           $$PWD/src/geworkspacesnapshot.h \
            $$PWD/src/workspacemanager.h
 SOURCES += $$PWD/src/gauss.cpp \
            $$PWD/src/gearray.cpp \
+           $$PWD/src/gearrayslice.cpp \
+           $$PWD/src/gebatchresult.cpp \
+           $$PWD/src/gebuffer.cpp \
+           $$PWD/src/gecancellationtoken.cpp \
+           $$PWD/src/gekernels.cpp \
+           $$PWD/src/gemappedfile.cpp \
            $$PWD/src/gematrix.cpp \
+           $$PWD/src/gematrixview.cpp \
+           $$PWD/src/geproccall.cpp \
+           $$PWD/src/geprofile.cpp \
+           $$PWD/src/geprogramcache.cpp \
            $$PWD/src/gestringarray.cpp \
            $$PWD/src/gesymbol.cpp \
+           $$PWD/src/geworkerpool.cpp \
            $$PWD/src/geworkspace.cpp \
+           $$PWD/src/geworkspacepool.cpp \
+           $$PWD/src/geworkspacesnapshot.cpp \
            $$PWD/src/workspacemanager.cpp 
 
 LIBS += -L$$MTENGHOME -lmteng
@@ -20,5 +20,16 @@ var y = x.getdata();
 console.log('y = ' + y);
 
 console.log(obj.getOutput());
-obj.shutdown();
+
+console.log('Testing asynchronous execution, the event loop keeps running meanwhile');
+var wh = obj.createWorkspace("async");
+var ticks = setInterval(() => process.stdout.write('.'), 10);
+
+obj.executeStringAsync("z = inv(rndn(300, 300)) * 2;", wh)
+    .then(ok => obj.getMatrixAsync("z", wh))
+    .then(z => {
+        clearInterval(ticks);
+        console.log('\nz is ' + z.getRows() + 'x' + z.getCols());
+        obj.shutdown();
+    });
 
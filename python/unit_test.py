@@ -148,6 +148,514 @@ class TestGAUSSEngine(unittest.TestCase):
             self.ge.destroyWorkspace(self.ge.getWorkspace("temp{}".format(i)))
 
 
+    def testProgramCache(self):
+        cache = self.ge.getProgramCache()
+        self.assertEqual(0, cache.maxEntries())
+
+        cache.setMaxEntries(2)
+        cache.resetStats()
+
+        for i in range(5):
+            self.assertTrue(self.ge.executeString("pc = 1 + 1"))
+
+        self.assertEqual(4, cache.hits())
+        self.assertEqual(1, cache.misses())
+        self.assertEqual(2, self.ge.getScalar("pc"))
+
+        # Least recently used programs are evicted
+        self.ge.executeString("pc2 = 2")
+        self.ge.executeString("pc3 = 3")
+        self.assertEqual(2, cache.count())
+        self.ge.executeString("pc = 1 + 1")
+        self.assertEqual(4, cache.hits())
+
+        # Failed compiles are not cached
+        self.assertFalse(self.ge.executeString("pc = ("))
+        self.assertEqual(2, cache.count())
+
+        cache.invalidate(self.ge.getActiveWorkspace())
+        self.assertEqual(0, cache.count())
+
+        cache.setMaxEntries(0)
+        self.ge.executeString("pc = 1 + 1")
+        self.assertEqual(0, cache.count())
+
+    def testProcCall(self):
+        ph = self.ge.compileString("proc (3) = pcfn(x, s, str); retp(x * s, areshape(x, 1|1|2), str $+ \"!\"); endp;")
+        self.assertTrue(self.ge.executeProgram(ph))
+
+        call = GEProcCall("pcfn")
+        self.assertTrue(call.addArg(GEMatrix([1.0, 2.0], 1, 2)))
+        self.assertTrue(call.addArg(10.0))
+        self.assertTrue(call.addArg("hi"))
+        self.assertEqual(3, call.getArgCount())
+
+        self.assertTrue(self.ge.callProc(ph, call))
+        self.assertEqual(3, call.getReturnCount())
+        self.assertEqual([10, 20], list(call.getReturn(0).getData()))
+        self.assertEqual(GESymType.ARRAY_GAUSS, call.getReturnType(1))
+        self.assertEqual([1, 1, 2], list(call.getReturn(1).getOrders()))
+        self.assertEqual("hi!", call.getReturn(2).getElement(0))
+        self.assertEqual(None, call.getReturn(3))
+
+        # Arguments are consumed unless they are kept
+        self.assertEqual(0, call.getArgCount())
+
+        call = GEProcCall("pcfn")
+        call.setKeepArgs(True)
+        call.addArg(GEMatrix([3.0], 1, 1))
+        call.addArg(2.0)
+        call.addArg("a")
+
+        for i in range(3):
+            self.assertTrue(self.ge.callProc(call))
+
+        self.assertEqual(3, call.getArgCount())
+        self.assertEqual(6, call.getReturn(0).getElement())
+
+        # Moved arguments are handed over without a copy and the local objects cleared
+        call = GEProcCall("pcfn")
+        m = GEMatrix([4.0, 5.0], 1, 2)
+        self.assertTrue(call.moveArg(m))
+        self.assertEqual(0, m.size())
+        self.assertTrue(call.addArg(2.0))
+        self.assertTrue(call.addArg("m"))
+        self.assertTrue(self.ge.callProc(call))
+        self.assertEqual([8, 10], list(call.getReturn(0).getData()))
+
+        a = GEArray([1, 1, 2], [1.0, 2.0])
+        call = GEProcCall("pcfn")
+        self.assertTrue(call.moveArg(a))
+        self.assertEqual(0, a.size())
+
+        self.assertFalse(self.ge.callProc(GEProcCall("pcmissing")))
+        self.ge.freeProgram(ph)
+
+    def testExpressions(self):
+        self.ge.executeString("ew = { 0.5, 0.25 }")
+        ph = self.ge.compileExpression("ex'ew")
+        self.assertNotEqual(None, ph)
+
+        for i in range(3):
+            self.ge.setSymbol(GEMatrix([float(i), 1.0], 2, 1), "ex")
+            self.assertEqual(0.5 * i + 0.25, self.ge.evaluateScalar(ph))
+
+        self.ge.freeProgram(ph)
+
+        ph = self.ge.compileExpression("seqa(1, 1, 3) * 2")
+        result = self.ge.evaluate(ph)
+        self.assertTrue(isinstance(result, GEMatrix))
+        self.assertEqual([2, 4, 6], list(result.getData()))
+        self.ge.freeProgram(ph)
+
+        ph = self.ge.compileExpression("\"abc\" $+ \"def\"")
+        self.assertEqual("abcdef", self.ge.evaluate(ph).getElement(0))
+        self.ge.freeProgram(ph)
+
+    def testCompiledBuffers(self):
+        import os, tempfile
+
+        ph = self.ge.compileString("cb = cb + 1")
+        fd, path = tempfile.mkstemp(suffix=".gcg")
+        os.close(fd)
+        self.assertTrue(self.ge.saveProgram(ph, path))
+        self.ge.freeProgram(ph)
+
+        with open(path, "rb") as f:
+            image = f.read()
+
+        self.ge.setScalar(1, "cb")
+        ph = self.ge.loadCompiledBuffer(image)
+        self.assertNotEqual(None, ph)
+        self.assertTrue(self.ge.executeProgram(ph))
+        self.assertEqual(2, self.ge.getScalar("cb"))
+        self.ge.freeProgram(ph)
+
+        mapped = GEMappedFile(path)
+        self.assertTrue(mapped.isValid())
+        self.assertEqual(len(image), mapped.size())
+
+        wh = self.ge.createWorkspace("cbws")
+        self.ge.setScalar(10, "cb", wh)
+        ph = self.ge.loadCompiledBuffer(mapped, wh)
+        self.assertTrue(self.ge.executeProgram(ph))
+        self.assertEqual(11, self.ge.getScalar("cb", wh))
+        self.ge.freeProgram(ph)
+
+        self.assertEqual(None, self.ge.loadCompiledBuffer(mapped, 1, mapped.size(), wh))
+        self.assertFalse(GEMappedFile(path + ".missing").isValid())
+
+        # Two programs stored back to back, loaded through the offset overload
+        ph = self.ge.compileString("cb = cb * 3")
+        self.assertTrue(self.ge.saveProgram(ph, path))
+        self.ge.freeProgram(ph)
+
+        with open(path, "rb") as f:
+            second = f.read()
+
+        with open(path, "wb") as f:
+            f.write(image + second)
+
+        del mapped
+        mapped = GEMappedFile(path)
+        self.assertEqual(len(image) + len(second), mapped.size())
+
+        self.ge.setScalar(1, "cb", wh)
+        ph1 = self.ge.loadCompiledBuffer(mapped, 0, len(image), wh)
+        ph2 = self.ge.loadCompiledBuffer(mapped, len(image), len(second), wh)
+        self.assertNotEqual(None, ph1)
+        self.assertNotEqual(None, ph2)
+        self.assertTrue(self.ge.executeProgram(ph1))
+        self.assertTrue(self.ge.executeProgram(ph2))
+        self.assertEqual(6, self.ge.getScalar("cb", wh))
+        self.ge.freeProgram(ph1)
+        self.ge.freeProgram(ph2)
+
+        self.ge.destroyWorkspace(wh)
+        del mapped
+        os.remove(path)
+
+    def testProfile(self):
+        import json
+
+        ph = self.ge.compileString("pf = 0; for i(1, 100, 1); pf = pf + sumc(rndu(10, 1)); endfor;")
+        profile = self.ge.profileProgram(ph)
+        self.assertNotEqual(None, profile)
+        self.assertTrue(self.ge.getScalar("pf") > 0)
+
+        report = json.loads(profile.toJson())
+        self.assertEqual(len(profile.getProcs()), len(report["procs"]))
+        self.assertTrue(profile.getTotalTime() >= 0)
+
+        folded = profile.toFoldedStacks()
+        self.assertEqual(len(set(line.rsplit(" ", 1)[0] for line in folded.splitlines())), len(folded.splitlines()))
+        self.ge.freeProgram(ph)
+
+        # Parsing does not depend on the engine
+        parsed = GEProfile("header\nmain prog.gss 2 10 1.5\nmain prog.gss 3 1 0.5\n")
+        self.assertEqual(2, parsed.getEntryCount())
+        self.assertEqual(2.0, parsed.getProcTime("main"))
+        self.assertEqual(11, parsed.getProcCount("main"))
+        self.assertEqual("main;prog.gss:2 1500000\nmain;prog.gss:3 500000\n", parsed.toFoldedStacks())
+
+        # Procedure totals only count for procedures without line records
+        parsed = GEProfile("Procedure File Line Count Time\n"
+                           "main prog.gss 0 1 2.5\n"
+                           "main prog.gss 2 10 1.5\n"
+                           "main prog.gss 3 1 0.5\n"
+                           "helper lib.src 5 0.25\n")
+        self.assertEqual(2, parsed.getEntryCount())
+        self.assertEqual(["main", "helper"], list(parsed.getProcs()))
+        self.assertEqual(2.0, parsed.getProcTime("main"))
+        self.assertEqual(11, parsed.getProcCount("main"))
+        self.assertEqual(0.25, parsed.getProcTime("helper"))
+        self.assertEqual(5, parsed.getProcCount("helper"))
+        self.assertEqual(2.25, parsed.getTotalTime())
+        self.assertEqual(2.25, json.loads(parsed.toJson())["totalTime"])
+        self.assertEqual("main;prog.gss:2 1500000\nmain;prog.gss:3 500000\nhelper 250000\n", parsed.toFoldedStacks())
+
+    def testAsync(self):
+        wh = self.ge.createWorkspace("asyncws")
+        self.ge.setScalar(0, "ao", wh)
+        results = []
+
+        # Jobs for one workspace run in the order they were queued
+        for i in range(1, 6):
+            self.ge.executeStringAsync("ao = ao * 10 + %d" % i, wh, results.append)
+
+        ph = self.ge.compileString("ao = ao + 100000", wh)
+        self.ge.executeProgramAsync(ph, wh, results.append)
+        self.ge.getMatrixAsync("ao", wh, lambda m: results.append(m.getElement()))
+        self.ge.getMatrixAsync("aomissing", wh, results.append)
+        self.ge.waitForAsync(wh)
+        self.assertEqual([True] * 6 + [112345, None], results)
+        self.ge.freeProgram(ph)
+
+        # Failures still reach the callback
+        self.ge.executeStringAsync("ao = ao +", wh, results.append)
+        self.ge.waitForAsync()
+        self.assertFalse(results[-1])
+
+        # A callback cannot wait for or destroy its own workspace
+        self.ge.executeStringAsync("ao = 1", wh, lambda ok: results.append(self.ge.destroyWorkspace(wh)))
+        self.ge.executeStringAsync("ao = 2", wh, lambda ok: self.ge.waitForAsync(wh))
+        self.ge.waitForAsync(wh)
+        self.assertFalse(results[-1])
+        self.assertEqual(2, self.ge.getScalar("ao", wh))
+
+        self.assertTrue(self.ge.destroyWorkspace(wh))
+
+    def testBatch(self):
+        steps = [self.ge.compileString("ba = 1"), self.ge.compileString("ba = ba * 3"), self.ge.compileString("bb = ba + 1")]
+
+        result = self.ge.executeBatch(steps)
+        self.assertEqual(3, result.size())
+        self.assertTrue(result.allSucceeded())
+        self.assertEqual(-1, result.getFirstFailure())
+        self.assertEqual(4, self.ge.getScalar("bb"))
+        self.assertTrue(result.getTotalTime() >= result.getTime(0))
+
+        for ph in steps:
+            self.ge.freeProgram(ph)
+
+        wh = self.ge.createWorkspace("batchws")
+
+        result = self.ge.executeBatch(["bc = 1", "bc = bc +", "bc = 5"], wh)
+        self.assertEqual(3, result.getExecutedCount())
+        self.assertEqual(1, result.getFirstFailure())
+        self.assertEqual(5, self.ge.getScalar("bc", wh))
+
+        result = self.ge.executeBatch(["bc = 1", "bc = bc +", "bc = 5"], wh, True)
+        self.assertEqual(2, result.getExecutedCount())
+        self.assertFalse(result.wasExecuted(2))
+        self.assertEqual(1, self.ge.getScalar("bc", wh))
+
+        self.ge.destroyWorkspace(wh)
+
+    def testWorkspaceRegistry(self):
+        import threading
+
+        wh = self.ge.createWorkspace("registry")
+        wh.setName("registry2")
+        self.assertTrue(self.ge.destroyWorkspace(wh))
+        self.assertTrue(self.ge.getWorkspace("registry") is None)
+
+        # Destroyed handles are rejected rather than dereferenced
+        self.assertFalse(self.ge.destroyWorkspace(wh))
+        self.assertFalse(self.ge.executeString("x = 1", wh))
+
+        active = self.ge.getActiveWorkspace()
+        results = []
+
+        def lookup():
+            results.append(all(self.ge.getActiveWorkspace().name() == active.name() for i in range(10000)))
+
+        threads = [threading.Thread(target=lookup) for i in range(8)]
+
+        for t in threads:
+            t.start()
+
+        for t in threads:
+            t.join()
+
+        self.assertEqual([True] * 8, results)
+
+    def testThreadLocalWorkspaces(self):
+        import threading
+
+        main = self.ge.getActiveWorkspace()
+        self.ge.setThreadLocalWorkspaces(True)
+        self.assertTrue(self.ge.threadLocalWorkspaces())
+
+        workspaces = [self.ge.createWorkspace("local" + str(i)) for i in range(4)]
+        results = [None] * len(workspaces)
+
+        def run(i):
+            # Threads start out on the default workspace
+            if self.ge.getActiveWorkspace().name() != main.name():
+                return
+
+            self.ge.setActiveWorkspace(workspaces[i])
+            self.ge.executeString("lx = " + str(i))
+            results[i] = self.ge.getScalar("lx")
+
+        threads = [threading.Thread(target=run, args=(i,)) for i in range(len(workspaces))]
+
+        for t in threads:
+            t.start()
+
+        for t in threads:
+            t.join()
+
+        self.assertEqual([0, 1, 2, 3], results)
+        self.assertEqual(main.name(), self.ge.getActiveWorkspace().name())
+
+        self.ge.setActiveWorkspace(workspaces[0])
+        self.assertEqual("local0", self.ge.getActiveWorkspace().name())
+        self.ge.destroyWorkspace(workspaces[0])
+        self.assertEqual(main.name(), self.ge.getActiveWorkspace().name())
+
+        self.ge.setActiveWorkspace(workspaces[1])
+        self.ge.clearThreadActiveWorkspace()
+        self.assertEqual(main.name(), self.ge.getActiveWorkspace().name())
+
+        self.ge.setThreadLocalWorkspaces(False)
+
+        for wh in workspaces[1:]:
+            self.ge.destroyWorkspace(wh)
+
+    def testCloneWorkspace(self):
+        templ = self.ge.createWorkspace("template")
+        self.assertTrue(self.ge.executeString("tx = seqa(1, 1, 5); ts = \"table\"; tu = 1", templ))
+
+        wh = self.ge.cloneWorkspace(templ, "clone", ["tx", "ts"])
+        self.assertTrue(wh is not None)
+        self.assertEqual([1, 2, 3, 4, 5], list(self.ge.getMatrix("tx", wh).getData()))
+        self.assertEqual("table", self.ge.getString("ts", wh))
+        self.assertNotEqual(GESymType.SCALAR, self.ge.getSymbolType("tu", wh))
+
+        # Clones are independent of the template
+        self.assertTrue(self.ge.executeString("tx = 0", wh))
+        self.assertEqual(5, self.ge.getMatrix("tx", templ).getRows())
+
+        self.assertTrue(self.ge.cloneWorkspace(templ, "clone", ["tx"]) is None)
+        self.assertTrue(self.ge.cloneWorkspace(templ, "clonebad", ["tmissing"]) is None)
+        self.assertTrue(self.ge.getWorkspace("clonebad") is None)
+
+        clones = self.ge.cloneWorkspaces(templ, ["clone" + str(i) for i in range(4)], ["tx"])
+        self.assertEqual(4, len(clones))
+
+        # Duplicate names get one workspace; the other entries fail
+        dups = self.ge.cloneWorkspaces(templ, ["clonedup"] * 4, ["tx"])
+        self.assertEqual(1, len([c for c in dups if c is not None]))
+        self.ge.destroyWorkspace(self.ge.getWorkspace("clonedup"))
+
+        for c in clones:
+            self.assertEqual(15, sum(self.ge.getMatrix("tx", c).getData()))
+            self.ge.destroyWorkspace(c)
+
+        self.ge.destroyWorkspace(wh)
+        self.ge.destroyWorkspace(templ)
+
+    def testWorkspaceSnapshot(self):
+        wh = self.ge.createWorkspace("snapshot")
+        self.assertTrue(self.ge.executeString("sx = { 1 2 3 }; ss = \"base\"", wh))
+
+        baseline = self.ge.snapshotWorkspace(wh)
+        self.assertTrue(baseline.isValid())
+        self.assertTrue(baseline.size() > 0)
+        self.assertEqual("snapshot", baseline.name())
+
+        for i in range(3):
+            self.assertTrue(self.ge.executeString("sx = sx * 10; ss = \"changed\"; sy = 1", wh))
+            self.assertTrue(self.ge.restoreWorkspace(baseline))
+            self.assertEqual([1, 2, 3], list(self.ge.getMatrix("sx", wh).getData()))
+            self.assertEqual("base", self.ge.getString("ss", wh))
+            self.assertNotEqual(GESymType.SCALAR, self.ge.getSymbolType("sy", wh))
+
+        # Restoring does not touch the active workspace, and works into other workspaces
+        active = self.ge.getActiveWorkspace()
+        other = self.ge.createWorkspace("snapshot2")
+        self.assertTrue(self.ge.restoreWorkspace(other, baseline))
+        self.assertEqual("snapshot2", other.name())
+        self.assertEqual("base", self.ge.getString("ss", other))
+        self.assertEqual(active.name(), self.ge.getActiveWorkspace().name())
+
+        self.ge.destroyWorkspace(wh)
+        self.assertFalse(self.ge.restoreWorkspace(baseline))
+        self.ge.destroyWorkspace(other)
+
+    def testWorkspacePool(self):
+        pool = self.ge.getWorkspacePool()
+        pool.setSetupCommand("base = 10")
+        pool.setSize(2, 3)
+        self.assertEqual(2, pool.available())
+
+        wh = pool.acquire()
+        self.assertTrue(wh is not None)
+        self.assertEqual(10, self.ge.getScalar("base", wh))
+        self.assertTrue(self.ge.executeString("base = 20; extra = 1", wh))
+        self.assertEqual(1, pool.inUse())
+
+        self.assertTrue(pool.release(wh))
+        self.assertFalse(pool.release(wh))
+        self.assertEqual(0, pool.inUse())
+
+        # Released workspaces are reset to the baseline
+        wh = pool.acquire()
+        self.assertEqual(10, self.ge.getScalar("base", wh))
+        self.assertNotEqual(GESymType.SCALAR, self.ge.getSymbolType("extra", wh))
+
+        others = [pool.acquire(), pool.acquire()]
+        self.assertEqual(3, pool.count())
+        self.assertTrue(pool.acquire(10) is None)
+        self.assertEqual(1, pool.waits())
+        self.assertEqual(1, pool.timeouts())
+        self.assertEqual(1.0, pool.utilization())
+
+        for w in others + [wh]:
+            pool.release(w)
+
+        self.assertEqual(3, pool.peakInUse())
+
+        # Workspaces being reset still count towards the maximum
+        import threading
+
+        pool.setSize(0, 2)
+        pool.resetStats()
+        counts = []
+
+        def worker():
+            for i in range(20):
+                w = pool.acquire()
+                counts.append(pool.count())
+                self.ge.executeString("base = base + 1", w)
+                pool.release(w)
+
+        threads = [threading.Thread(target=worker) for i in range(8)]
+
+        for t in threads:
+            t.start()
+
+        for t in threads:
+            t.join()
+
+        self.assertEqual(160, len(counts))
+        self.assertTrue(max(counts) <= 2)
+        self.assertEqual(0, pool.created())
+        self.assertTrue(pool.count() <= 2)
+
+        pool.setSize(0, 0)
+
+    def testThreads(self):
+        import threading
+
+        workspaces = [self.ge.createWorkspace("thread" + str(i)) for i in range(4)]
+        results = [False] * len(workspaces)
+
+        def run(i):
+            # Output goes through the Python director from each thread
+            code = "t = 0; for j(1, 20000, 1); t = t + j; endfor; print \"thread " + str(i) + " done\";"
+            results[i] = self.ge.executeString(code, workspaces[i])
+
+        threads = [threading.Thread(target=run, args=(i,)) for i in range(len(workspaces))]
+
+        for t in threads:
+            t.start()
+
+        for t in threads:
+            t.join()
+
+        for i, wh in enumerate(workspaces):
+            self.assertTrue(results[i])
+            self.assertEqual(200010000, self.ge.getScalar("t", wh))
+            self.ge.destroyWorkspace(wh)
+
+    def testCancellation(self):
+        ph = self.ge.compileString("dl = 0; do while 1; dl = dl + 1; endo;")
+        self.assertNotEqual(None, ph)
+
+        self.assertFalse(self.ge.executeProgram(ph, 200))
+        self.assertTrue(self.ge.getScalar("dl") > 0)
+
+        token = GECancellationToken()
+        token.cancelAfter(200)
+        self.assertFalse(self.ge.executeProgram(ph, token))
+        self.assertTrue(token.isCancelled())
+
+        # A cancelled token does not run the program until it is reset
+        self.ge.executeString("dl = 0")
+        self.assertFalse(self.ge.executeProgram(ph, token))
+        self.assertEqual(0, self.ge.getScalar("dl"))
+        self.assertTrue(token.reset())
+        self.assertFalse(token.isCancelled())
+
+        self.ge.freeProgram(ph)
+
+        ph = self.ge.compileString("dl = 1")
+        self.assertTrue(self.ge.executeProgram(ph, 5000))
+        self.ge.freeProgram(ph)
+
     def testMatrices(self):
         self.ge.executeString("x = 5")
         x = self.ge.getMatrix("x")
@@ -223,6 +731,188 @@ class TestGAUSSEngine(unittest.TestCase):
         self.ge["x"] = 11.0
         self.assertEqual(11.0, self.ge["x"][0])
 
+        m = GEMatrix([1.0, 2.0, 3.0, 4.0], 2, 2)
+        self.assertTrue(self.ge.moveSymbol(m, "m"))
+        self.assertEqual(1, m.size())
+        self.assertEqual([1, 2, 3, 4], list(self.ge.getMatrix("m").getData()))
+
+        a = GEArray([2, 1, 2], [1.0, 2.0, 3.0, 4.0])
+        self.assertTrue(self.ge.moveSymbol(a, "a"))
+        self.assertEqual([2, 1, 2], list(self.ge.getArray("a").getOrders()))
+
+    def testBatchSymbols(self):
+        self.ge.executeString("bx = { 1 2, 3 4 }; bs = \"batch\"; ba = areshape(seqa(1,1,8), 2|2|2)")
+
+        syms = self.ge.getSymbols(["bx", "bs", "ba", "bmissing", "bx"])
+        self.assertEqual(["ba", "bs", "bx"], sorted(syms.keys()))
+        self.assertTrue(isinstance(syms["bx"], GEMatrix))
+        self.assertTrue(isinstance(syms["ba"], GEArray))
+        self.assertTrue(isinstance(syms["bs"], GEStringArray))
+        self.assertEqual([1, 2, 3, 4], list(syms["bx"].getData()))
+        self.assertEqual([2, 2, 2], list(syms["ba"].getOrders()))
+
+        self.assertTrue(self.ge.setSymbols({ "by": GEMatrix([5.0, 6.0], 1, 2), "bb": syms["ba"] }))
+        self.assertEqual([5, 6], list(self.ge.getMatrix("by").getData()))
+        self.assertEqual([2, 2, 2], list(self.ge.getArray("bb").getOrders()))
+
+        self.assertEqual({}, self.ge.getSymbols(["bmissing"]))
+
+    def testMatrixViews(self):
+        self.ge.executeString("xv = complex({ 1 2 3, 4 5 6 }, { 7 8 9, 10 11 12 })")
+        xv = self.ge.getMatrixView("xv")
+        self.assertTrue(xv.isValid())
+        self.assertTrue(xv.isComplex())
+        self.assertEqual(2, xv.getRows())
+        self.assertEqual(3, xv.getCols())
+        self.assertEqual(3, xv.getRowStride())
+        self.assertEqual(1, xv.getColStride())
+        self.assertEqual(6, len(xv))
+
+        self.assertEqual(4, xv.getElement(1, 0))
+        self.assertEqual(10, xv.getElement(1, 0, True))
+        self.assertEqual(6, xv[-1])
+        self.assertEqual([1, 2, 3, 4, 5, 6], list(xv))
+        self.assertEqual([7, 8, 9, 10, 11, 12], list(xv.getImagData()))
+
+        # Reassigning the symbol invalidates the view
+        self.ge.executeString("xv = 5")
+        self.assertFalse(xv.isValid())
+        self.assertEqual(0, xv.getElement())
+        self.assertEqual([], list(xv.getData()))
+
+        # Writes to other symbols do not
+        xv = self.ge.getMatrixView("xv")
+        self.ge.setSymbol(GEMatrix([1.0, 2.0]), "yv")
+        self.assertTrue(xv.isValid())
+        self.assertEqual(5, xv.getElement())
+
+        # Freeing the workspace invalidates the view
+        tempWh = self.ge.createWorkspace("viewtemp")
+        self.ge.executeString("z = seqa(1,1,4)", tempWh)
+        zv = self.ge.getMatrixView("z", tempWh)
+        self.assertEqual(4, zv.getElement(3))
+
+        # Writes to another workspace leave the view alone, while compiled programs are tracked to
+        # the workspace they were compiled in
+        self.ge.executeString("z = 1")
+        self.assertTrue(zv.isValid())
+        ph = self.ge.compileString("z = 2", tempWh)
+        self.assertTrue(self.ge.executeProgram(ph))
+        self.assertFalse(zv.isValid())
+        self.ge.freeProgram(ph)
+
+        zv = self.ge.getMatrixView("z", tempWh)
+        self.ge.destroyWorkspace(tempWh)
+        self.assertFalse(zv.isValid())
+
+    def testBuffers(self):
+        self.ge.executeString("x = complex({ 1 2 3, 4 5 6 }, { 7 8 9, 10 11 12 })")
+        x = self.ge.getMatrix("x")
+
+        # Complex data is exposed with a leading real/imaginary axis
+        buf = x.getBuffer()
+        self.assertEqual((2, 2, 3), buf.shape)
+        self.assertEqual("d", buf.format)
+        self.assertEqual([[1, 2, 3], [4, 5, 6]], buf.tolist()[0])
+        self.assertEqual([[7, 8, 9], [10, 11, 12]], buf.tolist()[1])
+
+        # The buffer shares memory with the matrix
+        buf[0, 1, 2] = 60.0
+        self.assertEqual(60, x.getElement(1, 2))
+
+        self.ge.executeString("a = areshape(seqa(1,1,24), 2|3|4)")
+        a = self.ge.getArray("a")
+        buf = a.getBuffer()
+        self.assertEqual((2, 3, 4), buf.shape)
+        self.assertEqual([float(i) for i in range(1, 25)], buf.cast("B").cast("d").tolist())
+
+        self.assertEqual((2, 3), self.ge.getMatrix("x").__array_interface__["shape"][1:])
+
+    def testBufferImport(self):
+        import array
+
+        self.assertTrue(self.ge.setSymbol(array.array('d', [1.0, 2.0, 3.0]), "bx"))
+        bx = self.ge.getMatrix("bx")
+        self.assertEqual(1, bx.getRows())
+        self.assertEqual([1, 2, 3], list(bx.getData()))
+
+        data = memoryview(array.array('d', range(1, 13))).cast('B').cast('d', (2, 2, 3))
+        self.assertTrue(self.ge.moveMatrix(data, "bc"))
+        bc = self.ge.getMatrix("bc")
+        self.assertTrue(bc.isComplex())
+        self.assertEqual(2, bc.getRows())
+        self.assertEqual(3, bc.getCols())
+        self.assertEqual([7, 8, 9, 10, 11, 12], list(bc.getImagData()))
+
+        with self.assertRaises(TypeError):
+            self.ge.setSymbol(array.array('i', [1, 2, 3]), "bi")
+
+    def testInterleavedComplex(self):
+        import array
+
+        self.ge.executeString("x = complex({ 1 2, 3 4 }, { 5 6, 7 8 })")
+        x = self.ge.getMatrix("x")
+        self.assertEqual([1, 5, 2, 6, 3, 7, 4, 8], list(x.getInterleavedData()))
+
+        buf = x.getInterleavedBuffer()
+        self.assertEqual("Zd", buf.format)
+        self.assertEqual((2, 2), buf.shape)
+
+        # complex128 buffers are accepted by setSymbol
+        self.assertTrue(self.ge.setSymbol(buf, "xz"))
+        xz = self.ge.getMatrix("xz")
+        self.assertTrue(xz.isComplex())
+        self.assertEqual([5, 6, 7, 8], list(xz.getImagData()))
+
+        y = GEMatrix()
+        self.assertTrue(y.setInterleavedData(array.array('d', [1.0, 5.0, 2.0, 6.0]), 1, 2))
+        self.assertEqual([1, 2], list(y.getData()))
+        self.assertEqual([5, 6], list(y.getImagData()))
+        self.assertFalse(y.setInterleavedData(array.array('d', [1.0, 5.0]), 1, 2))
+
+        self.ge.executeString("c = complex(areshape(seqa(1, 1, 4), 2|1|2), areshape(seqa(5, 1, 4), 2|1|2))")
+        c = self.ge.getArray("c")
+        self.assertEqual([1, 5, 2, 6, 3, 7, 4, 8], list(c.getInterleavedData()))
+
+        a = GEArray()
+        self.assertTrue(a.setInterleavedData([2, 1, 2], array.array('d', list(c.getInterleavedData()))))
+        self.assertEqual([2, 1, 2], list(a.getOrders()))
+        self.assertEqual([5, 6, 7, 8], list(a.getImagData()))
+
+    def testLayouts(self):
+        import array
+
+        # Raw values in memory order
+        values = lambda m: list(array.array('d', m.tobytes(order='A')))
+
+        self.ge.executeString("x = { 1 2 3, 4 5 6 }")
+
+        rm = self.ge.getMatrixData("x", GELayout.ROW_MAJOR)
+        self.assertEqual((2, 3), rm.shape)
+        self.assertEqual([1, 2, 3, 4, 5, 6], values(rm))
+
+        cm = self.ge.getMatrixData("x", GELayout.COL_MAJOR)
+        self.assertTrue(cm.f_contiguous)
+        self.assertEqual([1, 4, 2, 5, 3, 6], values(cm))
+
+        # Fortran-ordered buffers are transposed on the way in
+        self.assertTrue(self.ge.setSymbol(cm, "y"))
+        y = self.ge.getMatrix("y")
+        self.assertEqual(2, y.getRows())
+        self.assertEqual([1, 2, 3, 4, 5, 6], list(y.getData()))
+
+        self.ge.executeString("c = complex(x, x * 10)")
+        cc = self.ge.getMatrixData("c", GELayout.COL_MAJOR)
+        self.assertEqual((2, 2, 3), cc.shape)
+        self.assertEqual((48, 8, 16), cc.strides)
+        self.assertEqual([1, 2, 3, 4, 5, 6, 10, 20, 30, 40, 50, 60], list(array.array('d', cc.tobytes())))
+
+        # Destroyed workspaces are rejected rather than read
+        wh = self.ge.createWorkspace("layoutws")
+        self.ge.executeString("x = 1", wh)
+        self.ge.destroyWorkspace(wh)
+        self.assertEqual(None, self.ge.getMatrixData("x", GELayout.ROW_MAJOR, wh))
+
     def testArrays(self):
         self.ge.executeString("ai = seqa(1,1,24); aj = seqa(25,1,24);")
 
@@ -259,6 +949,39 @@ class TestGAUSSEngine(unittest.TestCase):
         self.assertEqual(1, a2.getDimensions())
         self.assertEqual([0], list(a2.getData()))
 
+    def testArraySlices(self):
+        self.ge.executeString("as = areshape(seqa(1,1,120), 2|3|4|5); at = areshape(seqa(121,1,120), 2|3|4|5); au = complex(as,at)")
+        au = self.ge.getArray("au")
+
+        # Fixed leading indices select a contiguous block
+        s = au.slice([2, 3, 0, 0], [2, 3, 0, 0])
+        self.assertTrue(s.isValid())
+        self.assertTrue(s.isContiguous())
+        self.assertEqual([1, 1, 4, 5], list(s.getOrders()))
+        self.assertEqual([float(i) for i in range(101, 121)], list(s.getData()))
+        self.assertEqual([float(i) for i in range(221, 241)], list(s.getData(True)))
+
+        # Ranges and steps across several dimensions
+        s = au.slice([0, 2, 1, 5], [0, 3, 4, 1], [1, 1, 3, -2])
+        self.assertFalse(s.isContiguous())
+        self.assertEqual([2, 2, 2, 3], list(s.getOrders()))
+        self.assertEqual([25, 23, 21, 40, 38, 36, 45, 43, 41, 60, 58, 56], list(s.getData())[:12])
+        self.assertEqual(25, s.getElement([1, 1, 1, 1]))
+        self.assertEqual(216, s.getElement([2, 1, 2, 3], True))
+
+        packed = s.toArray()
+        self.assertTrue(packed.isComplex())
+        self.assertEqual([2, 2, 2, 3], list(packed.getOrders()))
+        self.assertEqual(list(s.getData(True)), list(packed.getImagData()))
+
+        # The strided buffer matches the packed copy
+        self.assertEqual([[25, 23, 21], [40, 38, 36]], s.getBuffer().tolist()[0][0][0])
+
+        # Out of range and mismatched arguments give an invalid slice
+        self.assertFalse(au.slice([3, 0, 0, 0], [3, 0, 0, 0]).isValid())
+        self.assertFalse(au.slice([0, 0], [0, 0]).isValid())
+        self.assertFalse(au.slice([0, 0, 0, 0], [0, 0, 0, 0], [1, 0, 1, 1]).isValid())
+
     def testStrings(self):
         geStr = "Hello World"
 
@@ -31,11 +31,18 @@ license = "MIT"
 sources = ["src/gauss.cpp", "src/gematrix.cpp",
          "src/gearray.cpp", "src/gestringarray.cpp",
          "src/geworkspace.cpp", "src/workspacemanager.cpp",
-         "src/gesymbol.cpp"]
+         "src/gesymbol.cpp",
+         "src/gematrixview.cpp",
+         "src/gebuffer.cpp",
+         "src/gekernels.cpp",
+         "src/gearrayslice.cpp",
+         "src/geprogramcache.cpp",
+         "src/geproccall.cpp", "src/geworkerpool.cpp", "src/gecancellationtoken.cpp", "src/gemappedfile.cpp", "src/geprofile.cpp", "src/gebatchresult.cpp", "src/geworkspacepool.cpp", "src/geworkspacesnapshot.cpp"]
 include_dirs = ["include", "src"] + ([lib_dir + "/pthreads"] if is_win else [])
 library_dirs = [lib_dir]
 define_macros = [("GAUSS_LIBRARY", None)]
-extra_compile_args = ["-std=c++11"] if not is_win else None
+extra_compile_args = ["-std=c++11", "-pthread"] if not is_win else None
+extra_link_args = ["-pthread"] if not is_win else None
 swig_opts = ["-c++"] + (["-py3"] if sys.version_info >= (3,0) else [])
 
 def mk_extension(ge_suffix=''):
@@ -46,6 +53,7 @@ def mk_extension(ge_suffix=''):
           libraries = ["mteng{}".format(ge_suffix)] + (["pthreadVC2"] if is_win else []),
           define_macros = define_macros,
           extra_compile_args = extra_compile_args,
+          extra_link_args = extra_link_args,
           swig_opts = swig_opts
     )
 
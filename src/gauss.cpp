@@ -6,8 +6,20 @@
 
 #include "gearray.h"
 #include "gematrix.h"
+#include "gematrixview.h"
+#include "gelayout.h"
+#include "gekernels.h"
 #include "gestringarray.h"
 #include "geworkspace.h"
+#include "geprogramcache.h"
+#include "geproccall.h"
+#include "gecancellationtoken.h"
+#include "gemappedfile.h"
+#include "geprofile.h"
+#include "gebatchresult.h"
+#include "geworkerpool.h"
+#include "geworkspacepool.h"
+#include "geworkspacesnapshot.h"
 #include "workspacemanager.h"
 #include "gefuncwrapper.h"
 #include "gauss_p.h"
@@ -24,6 +36,9 @@
 
 #include <stdio.h>
 #include <mutex>
+#include <thread>
+#include <chrono>
+#include <sys/stat.h>
 
 
 #ifdef _WIN32
@@ -42,6 +57,9 @@ static std::string kHomeVar = "MTENGHOME";
 thread_local std::string kOutputStore;
 thread_local std::string kErrorStore;
 
+// Hook generation last registered with the engine on this thread
+thread_local unsigned int kHooksInstalled = 0;
+
 IGEProgramOutput* GAUSS::outputFunc_ = 0;
 IGEProgramOutput* GAUSS::errorFunc_ = 0;
 IGEProgramFlushOutput* GAUSS::flushFunc_ = 0;
@@ -129,6 +147,7 @@ GAUSS::GAUSS(std::string inp, bool isEnvVar) {
 
 void GAUSS::Init(std::string homePath) {
     this->d = new GAUSSPrivate(homePath);
+    this->d->workspacePool_ = new GEWorkspacePool(this);
 
     resetHooks();
 
@@ -173,7 +192,12 @@ bool GAUSS::initialize() {
         return false;
     }
 
-    setActiveWorkspace(workspace);
+    this->d->manager_->setDefault(workspace);
+
+    // Threads register their hooks again with the new engine instance
+    GAUSSPrivate::hookGeneration_++;
+
+    this->d->workspacePool_->fill();
 
     return true;
 }
@@ -185,9 +209,12 @@ bool GAUSS::initialize() {
  * @see initialize()
  */
 void GAUSS::shutdown() {
+    this->d->stopAsync();
     destroyAllWorkspaces();
 
     GAUSS_Shutdown();
+
+    GAUSSPrivate::hookGeneration_++;
 }
 
 /**
@@ -210,6 +237,10 @@ GEWorkspace* GAUSS::createWorkspace(std::string name) {
  *
  * Note that you will not be able to manipulate symbols without an active workspace.
  *
+ * Queued asynchronous jobs for the workspace are finished first. When called from an asynchronous
+ * job or callback while jobs are still queued for _workspace_, including the calling job's own
+ * workspace, nothing is destroyed and `false` is returned.
+ *
  * @param workspace Workspace handle
  * @return Whether workspace was successfully removed
  *
@@ -217,20 +248,139 @@ GEWorkspace* GAUSS::createWorkspace(std::string name) {
  * @see destroyAllWorkspaces()
  */
 bool GAUSS::destroyWorkspace(GEWorkspace *workspace) {
+    if (workspace) {
+        // Let queued asynchronous jobs for this workspace finish first
+        std::shared_ptr<GEWorkerPool> pool = this->d->workerPool(false);
+
+        if (pool && !pool->wait(workspace->workspace()))
+            return false;
+
+        this->d->workspacePool_->forget(workspace);
+    }
+
+    this->d->programCache_->invalidate(workspace);
+
     return this->d->manager_->destroy(workspace);
 }
 
 /**
  * Clears all workspaces. Note that you will not be able to manipulate symbols
- * without an active workspace.
+ * without an active workspace. Does nothing when called from an asynchronous job or callback.
  *
  * @see createWorkspace(std::string)
  * @see destroyWorkspace(GEWorkspace*)
  */
 void GAUSS::destroyAllWorkspaces() {
+    std::shared_ptr<GEWorkerPool> pool = this->d->workerPool(false);
+
+    if (pool && !pool->waitAll())
+        return;
+
+    this->d->workspacePool_->drain();
+    this->d->programCache_->clear();
     this->d->manager_->destroyAll();
 }
 
+/**
+ * Create a workspace named _name_ holding copies of the globals _symbols_ from workspace _templ_.
+ * The symbols are copied within the engine with `GAUSS_CopyGlobal`, so large reference data
+ * loaded once into a template can be handed to new workspaces without running the load code
+ * again or passing the data through host memory. Only global symbols are copied; procedures
+ * must be compiled into the new workspace separately.
+ *
+ * The template must not be modified while it is being cloned.
+ *
+ * Example:
+ *
+__Python__
+```py
+templ = ge.createWorkspace("template")
+ge.executeString("rates = loadd(\"rates.dat\"); weights = rndu(1000, 1000);", templ)
+
+wh = ge.cloneWorkspace(templ, "worker1", ["rates", "weights"])
+ge.executeString("x = rows(weights)", wh)
+```
+ *
+ * @param templ        Workspace to copy from
+ * @param name         Name of the workspace to create
+ * @param symbols      Names of the globals to copy
+ * @return        New workspace, or `null` if _name_ is already in use or a symbol could not be copied.
+ *
+ * @see cloneWorkspaces(GEWorkspace*, const std::vector<std::string>&, const std::vector<std::string>&)
+ */
+GEWorkspace* GAUSS::cloneWorkspace(GEWorkspace *templ, std::string name, const std::vector<std::string> &symbols) {
+    if (!this->d->manager_->isValidWorkspace(templ))
+        return nullptr;
+
+    // Fails if the name is taken, so a clone never copies into a workspace someone else owns
+    GEWorkspace *workspace = this->d->manager_->createUnique(name);
+
+    if (!workspace)
+        return nullptr;
+
+    for (size_t i = 0; i < symbols.size(); ++i) {
+        char *symName = const_cast<char*>(symbols.at(i).c_str());
+
+        if (GAUSS_CopyGlobal(workspace->workspace(), symName, templ->workspace(), symName) != GAUSS_SUCCESS) {
+            destroyWorkspace(workspace);
+            return nullptr;
+        }
+    }
+
+    return workspace;
+}
+
+/**
+ * Create one workspace for each name in _names_, each holding copies of the globals _symbols_
+ * from workspace _templ_. The workspaces are cloned in parallel, using up to one thread per
+ * hardware core.
+ *
+ * Example:
+ *
+__Python__
+```py
+workers = ge.cloneWorkspaces(templ, ["worker" + str(i) for i in range(8)], ["rates", "weights"])
+```
+ *
+ * @param templ        Workspace to copy from
+ * @param names        Names of the workspaces to create
+ * @param symbols      Names of the globals to copy
+ * @return        New workspaces in the order of _names_. An entry is `null` if that clone failed,
+ *                which includes all but one occurrence of a repeated name.
+ *
+ * @see cloneWorkspace(GEWorkspace*, std::string, const std::vector<std::string>&)
+ */
+std::vector<GEWorkspace*> GAUSS::cloneWorkspaces(GEWorkspace *templ, const std::vector<std::string> &names, const std::vector<std::string> &symbols) {
+    std::vector<GEWorkspace*> ret(names.size(), nullptr);
+
+    if (names.empty() || !this->d->manager_->isValidWorkspace(templ))
+        return ret;
+
+    size_t threadCount = std::max(1u, std::thread::hardware_concurrency());
+    threadCount = std::min(threadCount, names.size());
+
+    std::atomic<size_t> next(0);
+
+    auto clone = [&]() {
+        size_t i;
+
+        while ((i = next++) < names.size())
+            ret[i] = cloneWorkspace(templ, names.at(i), symbols);
+    };
+
+    std::vector<std::thread> threads;
+
+    for (size_t i = 1; i < threadCount; ++i)
+        threads.push_back(std::thread(clone));
+
+    clone();
+
+    for (size_t i = 0; i < threads.size(); ++i)
+        threads.at(i).join();
+
+    return ret;
+}
+
 /**
  * Returns a handle to a specified workspace by _name_
  *
@@ -245,11 +395,13 @@ GEWorkspace* GAUSS::getWorkspace(std::string name) const {
 }
 
 /**
- * Return a handle to the currently active workspace.
+ * Return a handle to the currently active workspace. In thread-local mode this is the workspace
+ * bound by the calling thread, or the default workspace if the thread has not bound one.
  *
- * @return Active workspace objectut
+ * @return Active workspace object
  *
  * @see setActiveWorkspace(GEWorkspace*)
+ * @see setThreadLocalWorkspaces(bool)
  */
 GEWorkspace* GAUSS::getActiveWorkspace() const {
     return this->d->manager_->getCurrent();
@@ -271,6 +423,111 @@ bool GAUSS::saveWorkspace(GEWorkspace *workspace, std::string filename) {
     return (GAUSS_SaveWorkspace(workspace->workspace(), removeConst(&filename)) == GAUSS_SUCCESS);
 }
 
+/**
+ * Save the contents of a workspace to memory, so it can be rolled back to this state later with
+ * restoreWorkspace(). The workspace is saved with `GAUSS_SaveWorkspace` into an anonymous memory
+ * file, so no disk is involved; see GEWorkspaceSnapshot.
+ *
+ * Example:
+ *
+__Python__
+```py
+ge.executeString("library cmlmt; base = loadd(\"scenarios.dat\");")
+baseline = ge.snapshotWorkspace(ge.getActiveWorkspace())
+
+for shock in shocks:
+    ge.setScalar(shock, "shock")
+    ge.executeString("run scenario.gss")
+    ge.restoreWorkspace(baseline)
+```
+ *
+ * @param workspace        Workspace object
+ * @return        Snapshot, or `null` on failure
+ *
+ * @see restoreWorkspace(GEWorkspaceSnapshot*)
+ */
+GEWorkspaceSnapshot* GAUSS::snapshotWorkspace(GEWorkspace *workspace) {
+    if (!this->d->manager_->isValidWorkspace(workspace))
+        return nullptr;
+
+    // Let queued asynchronous jobs finish, so the snapshot sees their results
+    std::shared_ptr<GEWorkerPool> pool = this->d->workerPool(false);
+
+    if (pool)
+        pool->wait(workspace->workspace());
+
+    GEWorkspaceSnapshot *snapshot = new GEWorkspaceSnapshot(workspace->name());
+    std::string path;
+
+    if (snapshot->open())
+        path = snapshot->path();
+
+    if (path.empty() || GAUSS_SaveWorkspace(workspace->workspace(), removeConst(&path)) != GAUSS_SUCCESS) {
+        delete snapshot;
+        return nullptr;
+    }
+
+    return snapshot;
+}
+
+/**
+ * Restore the workspace a snapshot was taken from to the state it was in at the time. The
+ * workspace is looked up by the name it had when the snapshot was taken, so this fails once it
+ * has been destroyed, rather than touching a stale handle.
+ *
+ * @param snapshot        Snapshot returned by snapshotWorkspace()
+ * @return        True on success, false if no workspace has that name or it could not be restored.
+ *
+ * @see restoreWorkspace(GEWorkspace*, GEWorkspaceSnapshot*)
+ */
+bool GAUSS::restoreWorkspace(GEWorkspaceSnapshot *snapshot) {
+    return snapshot && restoreWorkspace(getWorkspace(snapshot->name()), snapshot);
+}
+
+/**
+ * Replace the contents of _workspace_ with a snapshot. The workspace object stays the same, so
+ * it remains active, pooled or bound to threads as before; unlike loadWorkspace() this does not
+ * change the active workspace. A snapshot can be restored into any workspace.
+ *
+ * Programs compiled in the workspace, and views of its symbols, are invalidated by the restore.
+ * No other calls may use the workspace while it is being restored.
+ *
+ * @param workspace        Workspace object
+ * @param snapshot        Snapshot returned by snapshotWorkspace()
+ * @return        True on success, false on failure
+ *
+ * @see snapshotWorkspace(GEWorkspace*)
+ */
+bool GAUSS::restoreWorkspace(GEWorkspace *workspace, GEWorkspaceSnapshot *snapshot) {
+    if (!snapshot || !snapshot->isValid() || !this->d->manager_->isValidWorkspace(workspace))
+        return false;
+
+    // Jobs still queued from an asynchronous callback would run against the replaced contents
+    std::shared_ptr<GEWorkerPool> pool = this->d->workerPool(false);
+
+    if (pool && !pool->wait(workspace->workspace()))
+        return false;
+
+    std::string path = snapshot->path();
+    WorkspaceHandle_t *wh = GAUSS_LoadWorkspace(removeConst(&path));
+
+    if (!wh)
+        return false;
+
+    this->d->programCache_->invalidate(workspace);
+
+    // Keep the registered name, which the saved workspace may not share
+    std::string name = workspace->name();
+    workspace->setWorkspace(wh);
+
+    if (workspace->name() != name)
+        workspace->setName(name);
+
+    workspace->touch();
+
+    return true;
+}
+
 /**
  * Saves a compiled program given by a program handle into a file. It saves all of the
  * workspace information, which is contained in the program handle. The file will have
@@ -287,16 +544,65 @@ bool GAUSS::saveProgram(ProgramHandle_t *ph, std::string filename) {
 }
 
 /**
- * Sets the active workspace to be the specified workspace.
+ * Sets the active workspace to be the specified workspace. In thread-local mode this only
+ * affects the calling thread.
  *
  * @param workspace        Workspace object
  *
  * @see getActiveWorkspace()
+ * @see setThreadLocalWorkspaces(bool)
  */
 bool GAUSS::setActiveWorkspace(GEWorkspace *workspace) {
     return this->d->manager_->setCurrent(workspace);
 }
 
+/**
+ * Enable or disable thread-local active workspaces. When enabled, setActiveWorkspace() binds a
+ * workspace for the calling thread only, and the overloads that take no workspace argument use
+ * that binding. Threads that have not bound a workspace use the default one, which is the active
+ * workspace at the time the mode was enabled. Looking up a thread's workspace takes no lock.
+ *
+ * This is disabled by default.
+ *
+ * Example:
+ *
+__Python__
+```py
+ge.setThreadLocalWorkspaces(True)
+
+def worker(i):
+    ge.setActiveWorkspace(ge.createWorkspace("worker" + str(i)))
+    ge.executeString("x = " + str(i))    # runs in this thread's workspace
+    print(ge.getScalar("x"))
+```
+ *
+ * @param enabled        Whether each thread has its own active workspace
+ *
+ * @see clearThreadActiveWorkspace()
+ */
+void GAUSS::setThreadLocalWorkspaces(bool enabled) {
+    this->d->manager_->setThreadLocal(enabled);
+}
+
+/**
+ * Return whether each thread has its own active workspace.
+ *
+ * @see setThreadLocalWorkspaces(bool)
+ */
+bool GAUSS::threadLocalWorkspaces() const {
+    return this->d->manager_->isThreadLocal();
+}
+
+/**
+ * Remove the calling thread's workspace binding, so it uses the default workspace again.
+ * Destroying a workspace removes it from all threads that bound it.
+ *
+ * @see setThreadLocalWorkspaces(bool)
+ */
+void GAUSS::clearThreadActiveWorkspace() {
+    this->d->manager_->clearThreadCurrent();
+}
+
 /**
  * Returns the current path known by the GAUSS Engine for the user home directory.
  *
@@ -438,16 +744,12 @@ bool GAUSS::executeString(std::string command, GEWorkspace *workspace) {
     if (!this->d->manager_->isValidWorkspace(workspace))
         return false;
 
-    ProgramHandle_t *ph = GAUSS_CompileString(workspace->workspace(), removeConst(&command), 0, 0);
+    std::shared_ptr<ProgramHandle_t> ph = this->d->compileString(workspace->workspace(), command);
 
     if (!ph)
         return false;
 
-    bool ret = executeProgram(ph);
-
-    GAUSS_FreeProgram(ph);
-
-    return ret;
+    return runProgram(ph.get(), workspace);
 }
 
 /**
@@ -507,12 +809,31 @@ bool GAUSS::executeFile(std::string filename, GEWorkspace *workspace) {
     else if (!this->d->manager_->isValidWorkspace(workspace))
         return false;
 
+    GEProgramCache *cache = this->d->programCache_;
+    struct stat st;
+
+    if (cache->enabled() && stat(filename.c_str(), &st) == 0) {
+        WorkspaceHandle_t *wh = workspace->workspace();
+        std::shared_ptr<ProgramHandle_t> cached = cache->find(wh, GEProgramCache::SOURCE_FILE, filename, st.st_mtime, st.st_size);
+
+        if (!cached) {
+            ProgramHandle_t *ph = GAUSS_CompileFile(wh, removeConst(&filename), 0, 0);
+
+            if (!ph)
+                return false;
+
+            cached = cache->insert(wh, GEProgramCache::SOURCE_FILE, filename, ph, st.st_mtime, st.st_size);
+        }
+
+        return runProgram(cached.get(), workspace);
+    }
+
     ProgramHandle_t *ph = GAUSS_CompileFile(workspace->workspace(), removeConst(&filename), 0, 0);
 
     if (!ph)
         return false;
 
-    bool ret = executeProgram(ph);
+    bool ret = runProgram(ph, workspace);
 
     GAUSS_FreeProgram(ph);
 
@@ -583,7 +904,7 @@ bool GAUSS::executeCompiledFile(std::string filename, GEWorkspace *workspace) {
     if (!ph)
         return false;
 
-    bool ret = executeProgram(ph);
+    bool ret = runProgram(ph, workspace);
 
     GAUSS_FreeProgram(ph);
 
@@ -677,7 +998,7 @@ ProgramHandle_t* GAUSS::compileString(std::string command, GEWorkspace *workspac
     if (!this->d->manager_->isValidWorkspace(workspace))
         return nullptr;
 
-    return GAUSS_CompileString(workspace->workspace(), removeConst(&command), 0, 0);
+    return this->d->addProgram(GAUSS_CompileString(workspace->workspace(), removeConst(&command), 0, 0), workspace);
 }
 
 /**
@@ -742,7 +1063,7 @@ ProgramHandle_t* GAUSS::compileFile(std::string filename, GEWorkspace *workspace
     if (!this->d->manager_->isValidWorkspace(workspace))
         return nullptr;
 
-    return GAUSS_CompileFile(workspace->workspace(), removeConst(&filename), 0, 0);
+    return this->d->addProgram(GAUSS_CompileFile(workspace->workspace(), removeConst(&filename), 0, 0), workspace);
 }
 
 /**
@@ -776,130 +1097,1139 @@ ProgramHandle_t* GAUSS::loadCompiledFile(std::string filename, GEWorkspace *work
     if (!this->d->manager_->isValidWorkspace(workspace))
         return nullptr;
 
-    return GAUSS_LoadCompiledFile(workspace->workspace(), removeConst(&filename));
+    return this->d->addProgram(GAUSS_LoadCompiledFile(workspace->workspace(), removeConst(&filename)), workspace);
 }
 
 /**
- * Executes a given program handle that was created with either compileString(std::string), compileFile(std::string),
- * or loadCompiledFile(std::string).
+ * Loads a compiled program from memory into the active workspace and returns a program handle.
+ *
+ * @param buffer        Contents of a compiled program file
+ * @param size        Size of _buffer_ in bytes
+ * @return        Program handle
+ *
+ * @see loadCompiledBuffer(const char*, size_t, GEWorkspace*)
+ */
+ProgramHandle_t* GAUSS::loadCompiledBuffer(const char *buffer, size_t size) {
+    return loadCompiledBuffer(buffer, size, getActiveWorkspace());
+}
+
+/**
+ * Loads a compiled program from memory into a specific workspace and returns a program handle.
+ * _buffer_ must hold the complete contents of a file written by saveProgram(ProgramHandle_t*, std::string),
+ * so programs can be shipped and instantiated without touching the file system.
  *
  * Example:
  *
 __Python__
 ```py
-ph = ge.compileString("x = rndu(3,3)")
+with open("example.gcg", "rb") as f:
+    image = f.read()
+
+ph = ge.loadCompiledBuffer(image, myWorkspace)
 ge.executeProgram(ph)
 ```
  *
-__PHP__
-```php
-$ph = $ge->compileString("x = rndu(3,3)");
-$ge->executeProgram($ph);
-```
- *
+ * The first _size_ bytes of _buffer_ are copied into a private buffer before they are passed to
+ * the engine, so _buffer_ itself is never modified. Note that `GAUSS_LoadCompiledBuffer` takes no
+ * length and reads as far as the program image's own header says, so _size_ cannot bound the
+ * engine's read: a truncated or corrupt image may be read past its end. The layout of that header
+ * is not part of the engine API, so it is not checked here; only pass complete images written by
+ * saveProgram(ProgramHandle_t*, std::string). The copy is released once the engine has loaded the
+ * program, which does not refer to it afterwards.
  *
- * @param ph Program handle
- * @return        True on success. False on failure
+ * @param buffer        Contents of a compiled program file
+ * @param size        Size of _buffer_ in bytes
+ * @param workspace    Workspace handle
+ * @return        Program handle
  *
- * @see compileString(std::string)
- * @see compileFile(std::string)
- * @see loadCompiledFile(std::string)
- * @see freeProgram(ProgramHandle_t*)
+ * @see loadCompiledFile(std::string, GEWorkspace*)
+ * @see loadCompiledBuffer(GEMappedFile*, GEWorkspace*)
  */
-bool GAUSS::executeProgram(ProgramHandle_t *ph) {
-    if (!ph)
-        return false;
-
-    // Setup output hook
-    resetHooks();
+ProgramHandle_t* GAUSS::loadCompiledBuffer(const char *buffer, size_t size, GEWorkspace *workspace) {
+    if (!buffer || !size || !this->d->manager_->isValidWorkspace(workspace))
+        return nullptr;
 
-    if (GAUSS_Execute(ph) != 0)
-        return false;
+    // The engine takes a mutable pointer, and the caller's memory may be read-only
+    std::vector<char> image(buffer, buffer + size);
 
-    return true;
+    return this->d->addProgram(GAUSS_LoadCompiledBuffer(workspace->workspace(), image.data()), workspace);
 }
 
 /**
- * Gets the workspace information saved in a file and
- * returns it in a workspace handle. This also sets the loaded workspace
- * to be the current workspace.
- *
- * If _loadWorkspace_ fails, _wh_ will be `null`. Use getError() to
- * get the number of the error. _loadWorkspace_ may fail with either of
- * the following errors:
+ * Loads a compiled program from a mapped file into the active workspace and returns a program handle.
  *
- * Error | Reason
- * -----:|------------
- * 30    | Insufficient memory.
- * 495   | Workspace inactive or corrupt.
+ * @param file        Mapped compiled program file
+ * @return        Program handle
  *
- * @param gcgfile        name of file workspace is stored in
- * @return        pointer to a workspace handle.
+ * @see loadCompiledBuffer(GEMappedFile*, GEWorkspace*)
  */
-GEWorkspace* GAUSS::loadWorkspace(std::string gcgfile) {
-    WorkspaceHandle_t *workspace = GAUSS_LoadWorkspace(removeConst(&gcgfile));
-
-    if (!workspace)
-        return nullptr;
-
-    GEWorkspace *newWh = new GEWorkspace(workspace);
-
-    updateWorkspaceName(newWh);
-
-    // set as active workspace
-    setActiveWorkspace(newWh);
-
-    return newWh;
+ProgramHandle_t* GAUSS::loadCompiledBuffer(GEMappedFile *file) {
+    return loadCompiledBuffer(file, getActiveWorkspace());
 }
 
 /**
- * Returns the current associated name of a workspace according to GAUSS
+ * Loads a compiled program from a mapped file into a specific workspace and returns a program
+ * handle. The file is only mapped once, however many workspaces the program is loaded into.
  *
- * @param workspace Workspace handle
- * @return        Workspace name
+ * @param file        Mapped compiled program file
+ * @param workspace    Workspace handle
+ * @return        Program handle
  *
- * @see getActiveWorkspace()
+ * @see GEMappedFile
  */
-std::string GAUSS::getWorkspaceName(GEWorkspace *workspace) const {
-    if (!this->d->manager_->isValidWorkspace(workspace))
-        return std::string();
-
-    char name[1024];
-    memset(&name, 0, sizeof(name));
-
-    GAUSS_GetWorkspaceName(workspace->workspace(), name);
+ProgramHandle_t* GAUSS::loadCompiledBuffer(GEMappedFile *file, GEWorkspace *workspace) {
+    if (!file)
+        return nullptr;
 
-    return std::string(name);
+    return loadCompiledBuffer(file, 0, file->size(), workspace);
 }
 
 /**
- * Request the workspace name from GAUSS, and set the _name_
- * field in the GEWorkspace object.
+ * Loads one of several compiled programs stored back to back in a mapped file. The range is
+ * checked against the file and copied as described in
+ * loadCompiledBuffer(const char*, size_t, GEWorkspace*), but the engine still reads as far as
+ * the image's header says, so _size_ must be the exact size of a complete program image.
  *
- * @param workspace        Workspace handle
+ * Example:
  *
- * @see getWorkspaceName(GEWorkspace*)
+__Python__
+```py
+bundle = GEMappedFile("programs.bin")    # two .gcg files concatenated
+ph1 = ge.loadCompiledBuffer(bundle, 0, size1, myWorkspace)
+ph2 = ge.loadCompiledBuffer(bundle, size1, size2, myWorkspace)
+```
+ *
+ * @param file        Mapped file
+ * @param offset        Byte offset of the program within _file_
+ * @param size        Size of the program in bytes
+ * @param workspace    Workspace handle
+ * @return        Program handle, or `nullptr` if the range is outside the file
+ *
+ * @see loadCompiledBuffer(GEMappedFile*, GEWorkspace*)
  */
-void GAUSS::updateWorkspaceName(GEWorkspace *workspace) {
-    std::string wkspName = getWorkspaceName(workspace);
+ProgramHandle_t* GAUSS::loadCompiledBuffer(GEMappedFile *file, size_t offset, size_t size, GEWorkspace *workspace) {
+    if (!file || !file->isValid() || offset >= file->size() || size > file->size() - offset)
+        return nullptr;
 
-    workspace->setName(wkspName);
+    return loadCompiledBuffer(file->data() + offset, size, workspace);
 }
 
 /**
- * Free a program handle created by compileString(std::string),
- * compileFile(std::string), and loadCompiledFile(std::string)
+ * Compile an expression in the active workspace and return a program handle. Evaluate it as many
+ * times as needed with evaluate(ProgramHandle_t*) or evaluateScalar(ProgramHandle_t*), which return
+ * the result directly rather than assigning it to a global. Free it with freeProgram(ProgramHandle_t*).
  *
- * @param ph        Program handle
+ * Example:
  *
- * @see compileString(std::string)
- * @see compileFile(std::string)
- * @see loadCompiledFile(std::string)
- * @see executeProgram(ProgramHandle_t*)
- */
-void GAUSS::freeProgram(ProgramHandle_t *ph) {
-    GAUSS_FreeProgram(ph);
-}
+__Python__
+```py
+ge.executeString("w = { 0.5, 0.25 }")
+ph = ge.compileExpression("x'w")
+
+for i in range(0, 3):
+    ge.setSymbol(GEMatrix([i, 1.0], 2, 1), "x")
+    print(ge.evaluateScalar(ph))
+
+ge.freeProgram(ph)
+```
+ * will result in the output:
+```
+0.25
+0.75
+1.25
+```
+ *
+ * @param expression        Expression to compile
+ * @return        Program handle, or `null` on failure
+ *
+ * @see evaluate(ProgramHandle_t*)
+ * @see evaluateScalar(ProgramHandle_t*)
+ * @see compileExpression(std::string, GEWorkspace*)
+ */
+ProgramHandle_t* GAUSS::compileExpression(std::string expression) {
+    return compileExpression(expression, getActiveWorkspace());
+}
+
+/**
+ * Compile an expression in a specific workspace and return a program handle. Evaluate it as many
+ * times as needed with evaluate(ProgramHandle_t*) or evaluateScalar(ProgramHandle_t*).
+ *
+ * @param expression        Expression to compile
+ * @param workspace    Workspace handle
+ * @return        Program handle, or `null` on failure
+ *
+ * @see evaluate(ProgramHandle_t*)
+ * @see evaluateScalar(ProgramHandle_t*)
+ * @see compileExpression(std::string)
+ */
+ProgramHandle_t* GAUSS::compileExpression(std::string expression, GEWorkspace *workspace) {
+    if (!this->d->manager_->isValidWorkspace(workspace))
+        return nullptr;
+
+    return this->d->addProgram(GAUSS_CompileExpression(workspace->workspace(), removeConst(&expression), 0, 0), workspace);
+}
+
+/**
+ * Evaluate an expression compiled with compileExpression(std::string) and return its value.
+ * The result is moved out of the engine without a copy and without a symbol table lookup.
+ *
+ * @param ph        Program handle
+ * @return        GEMatrix, GEArray or GEStringArray object, or `null` on failure. The caller takes
+ *                ownership of the returned object.
+ *
+ * @see compileExpression(std::string)
+ * @see evaluateScalar(ProgramHandle_t*)
+ */
+GESymbol* GAUSS::evaluate(ProgramHandle_t *ph) {
+    if (!ph)
+        return nullptr;
+
+    // Setup output hook
+    ensureHooks();
+
+    // Expression may reassign globals, invalidating outstanding views
+    this->d->touchProgram(ph);
+
+    ArgList_t *ret = GAUSS_ExecuteExpression(ph);
+
+    if (!ret)
+        return nullptr;
+
+    GESymbol *symbol = ret->num > 0 ? GAUSSPrivate::moveArgToSymbol(ret, 1) : nullptr;
+
+    GAUSS_FreeArgList(ret);
+
+    return symbol;
+}
+
+/**
+ * Evaluate an expression compiled with compileExpression(std::string) and return the first
+ * element of its value as a primitive `double`. No result object is created, which makes this
+ * the cheapest way to evaluate a scalar expression repeatedly.
+ *
+ * @param ph        Program handle
+ * @return        First element of the result, or 0 on failure or if the result is not numeric.
+ *
+ * @see compileExpression(std::string)
+ * @see evaluate(ProgramHandle_t*)
+ */
+double GAUSS::evaluateScalar(ProgramHandle_t *ph) {
+    if (!ph)
+        return 0.0;
+
+    ensureHooks();
+
+    this->d->touchProgram(ph);
+
+    ArgList_t *ret = GAUSS_ExecuteExpression(ph);
+
+    if (!ret)
+        return 0.0;
+
+    double value = 0.0;
+
+    if (ret->num > 0) {
+        switch (GAUSS_GetArgType(ret, 1)) {
+        case GESymType::SCALAR:
+        case GESymType::MATRIX: {
+            Matrix_t *gsMat = GAUSS_MoveArgToMatrix(ret, 1);
+
+            if (gsMat) {
+                if (gsMat->mdata && gsMat->rows * gsMat->cols > 0)
+                    value = gsMat->mdata[0];
+
+                GAUSS_Free(gsMat->mdata);
+                GAUSS_Free(gsMat);
+            }
+            break;
+        }
+        case GESymType::ARRAY_GAUSS: {
+            Array_t *gsArray = GAUSS_MoveArgToArray(ret, 1);
+
+            // Array data follows the orders
+            if (gsArray) {
+                if (gsArray->adata && gsArray->dims > 0)
+                    value = gsArray->adata[gsArray->dims];
+
+                GAUSS_Free(gsArray->adata);
+                GAUSS_Free(gsArray);
+            }
+            break;
+        }
+        default:
+            break;
+        }
+    }
+
+    GAUSS_FreeArgList(ret);
+
+    return value;
+}
+
+/**
+ * Executes a given program handle that was created with either compileString(std::string), compileFile(std::string),
+ * or loadCompiledFile(std::string).
+ *
+ * Example:
+ *
+__Python__
+```py
+ph = ge.compileString("x = rndu(3,3)")
+ge.executeProgram(ph)
+```
+ *
+__PHP__
+```php
+$ph = $ge->compileString("x = rndu(3,3)");
+$ge->executeProgram($ph);
+```
+ *
+ *
+ * @param ph Program handle
+ * @return        True on success. False on failure
+ *
+ * @see compileString(std::string)
+ * @see compileFile(std::string)
+ * @see loadCompiledFile(std::string)
+ * @see freeProgram(ProgramHandle_t*)
+ */
+bool GAUSS::executeProgram(ProgramHandle_t *ph) {
+    if (!ph)
+        return false;
+
+    // Setup output hook
+    ensureHooks();
+
+    // Program may reassign any symbol, invalidating outstanding views
+    this->d->touchProgram(ph);
+
+    if (GAUSS_Execute(ph) != 0)
+        return false;
+
+    return true;
+}
+
+/**
+ * Execute a program the caller knows to belong to _workspace_, without looking it up in the
+ * program registry.
+ */
+bool GAUSS::runProgram(ProgramHandle_t *ph, GEWorkspace *workspace) {
+    ensureHooks();
+
+    // Program may reassign any symbol, invalidating outstanding views of this workspace
+    workspace->touch();
+
+    return GAUSS_Execute(ph) == 0;
+}
+
+/**
+ * Executes compiled programs back to back, installing the output and input hooks once for the
+ * whole batch instead of once per program. The time and result of each program are recorded in
+ * the returned GEBatchResult.
+ *
+ * Example:
+ *
+__Python__
+```py
+steps = [ge.compileString("a = rndu(100, 1)"), ge.compileString("b = a * 2"), ge.compileString("c = sumc(b)")]
+
+result = ge.executeBatch(steps, True)
+
+for i in range(0, result.size()):
+    print(i, result.getSuccess(i), result.getTime(i))
+```
+ *
+ * @param programs        Program handles to execute, in order
+ * @param stopOnFailure        Skip the remaining programs after the first failure
+ * @return        Per-program status and timing
+ *
+ * @see executeBatch(const std::vector<std::string>&, GEWorkspace*, bool)
+ */
+GEBatchResult* GAUSS::executeBatch(const std::vector<ProgramHandle_t*> &programs, bool stopOnFailure) {
+    GEBatchResult *result = new GEBatchResult;
+    result->resize(programs.size());
+
+    // Setup output hook
+    ensureHooks();
+
+    for (size_t i = 0; i < programs.size(); ++i) {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        bool success = false;
+
+        if (programs.at(i)) {
+            // Program may reassign any symbol, invalidating outstanding views
+            this->d->touchProgram(programs.at(i));
+
+            success = (GAUSS_Execute(programs.at(i)) == 0);
+        }
+
+        result->setItem(i, success, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+
+        if (!success && stopOnFailure)
+            break;
+    }
+
+    return result;
+}
+
+/**
+ * Compiles and executes commands back to back in the active workspace.
+ *
+ * @param commands        Commands to execute, in order
+ * @param stopOnFailure        Skip the remaining commands after the first failure
+ * @return        Per-command status and timing
+ *
+ * @see executeBatch(const std::vector<std::string>&, GEWorkspace*, bool)
+ */
+GEBatchResult* GAUSS::executeBatch(const std::vector<std::string> &commands, bool stopOnFailure) {
+    return executeBatch(commands, getActiveWorkspace(), stopOnFailure);
+}
+
+/**
+ * Compiles and executes commands back to back in a specific workspace, installing the output and
+ * input hooks once for the whole batch. Compiled commands are reused from the program cache when
+ * it is enabled. A command that fails to compile counts as a failure, and the reported time of
+ * each command includes its compilation.
+ *
+ * Example:
+ *
+__Python__
+```py
+result = ge.executeBatch(["x = 1", "y = x + ", "z = 3"], myWorkspace)
+print(result.getFirstFailure())
+```
+ * will result in the output:
+```
+1
+```
+ *
+ * @param commands        Commands to execute, in order
+ * @param workspace        Workspace handle
+ * @param stopOnFailure        Skip the remaining commands after the first failure
+ * @return        Per-command status and timing
+ *
+ * @see executeBatch(const std::vector<ProgramHandle_t*>&, bool)
+ * @see getProgramCache()
+ */
+GEBatchResult* GAUSS::executeBatch(const std::vector<std::string> &commands, GEWorkspace *workspace, bool stopOnFailure) {
+    GEBatchResult *result = new GEBatchResult;
+    result->resize(commands.size());
+
+    if (!this->d->manager_->isValidWorkspace(workspace))
+        return result;
+
+    WorkspaceHandle_t *wh = workspace->workspace();
+
+    // Setup output hook
+    ensureHooks();
+
+    for (size_t i = 0; i < commands.size(); ++i) {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        bool success = false;
+
+        std::shared_ptr<ProgramHandle_t> ph = this->d->compileString(wh, commands.at(i));
+
+        if (ph) {
+            // Program may reassign any symbol, invalidating outstanding views
+            workspace->touch();
+
+            success = (GAUSS_Execute(ph.get()) == 0);
+        }
+
+        result->setItem(i, success, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+
+        if (!success && stopOnFailure)
+            break;
+    }
+
+    return result;
+}
+
+/**
+ * Executes a given program handle with profiling enabled, and returns the collected profile. The
+ * engine writes its report to an in-memory stream, which is parsed into a GEProfile object.
+ *
+ * Example:
+ *
+__Python__
+```py
+ph = ge.compileFile("estimate.gss")
+profile = ge.profileProgram(ph)
+
+for name in profile.getProcs():
+    print(name, profile.getProcCount(name), profile.getProcTime(name))
+
+open("estimate.json", "w").write(profile.toJson())
+```
+ *
+ * @param ph Program handle
+ * @return        Profile of the run, or `nullptr` if execution failed
+ *
+ * @see GEProfile
+ * @see executeProgram(ProgramHandle_t*)
+ */
+GEProfile* GAUSS::profileProgram(ProgramHandle_t *ph) {
+    if (!ph)
+        return nullptr;
+
+#ifdef _WIN32
+    // No memory streams on Windows, use an anonymous temporary file instead
+    FILE *fp = tmpfile();
+#else
+    char *buf = nullptr;
+    size_t len = 0;
+    FILE *fp = open_memstream(&buf, &len);
+#endif
+
+    if (!fp)
+        return nullptr;
+
+    // Setup output hook
+    ensureHooks();
+
+    // Program may reassign any symbol, invalidating outstanding views
+    this->d->touchProgram(ph);
+
+    int ret = GAUSS_ProfileExecute(ph, fp);
+
+    std::string report;
+
+#ifdef _WIN32
+    rewind(fp);
+
+    char chunk[4096];
+    size_t count = 0;
+
+    while ((count = fread(chunk, 1, sizeof(chunk), fp)) > 0)
+        report.append(chunk, count);
+
+    fclose(fp);
+#else
+    // Closing the stream finalizes buf and len
+    fclose(fp);
+
+    if (buf) {
+        report.assign(buf, len);
+        free(buf);
+    }
+#endif
+
+    if (ret != 0)
+        return nullptr;
+
+    return new GEProfile(report);
+}
+
+/**
+ * Executes a given program handle, interrupting it if it is still running after _timeout_
+ * milliseconds. A _timeout_ of `0` or less waits indefinitely.
+ *
+ * Example:
+ *
+__Python__
+```py
+ph = ge.compileString("x = 0; do while 1; x = x + 1; endo;")
+
+if not ge.executeProgram(ph, 1000):
+    print("Program failed or took longer than 1s")
+```
+ *
+ * @param ph Program handle
+ * @param timeout Time limit in milliseconds
+ * @return        True on success. False on failure or timeout
+ *
+ * @see executeProgram(ProgramHandle_t*, GECancellationToken*)
+ */
+bool GAUSS::executeProgram(ProgramHandle_t *ph, int timeout) {
+    if (timeout <= 0)
+        return executeProgram(ph);
+
+    GECancellationToken token;
+    token.cancelAfter(timeout);
+
+    return executeProgram(ph, &token);
+}
+
+/**
+ * Executes a given program handle, which can be interrupted through _token_ from another thread
+ * or when the token's deadline passes. If the token is already cancelled, the program is not
+ * executed. A token can only be used by one execution at a time.
+ *
+ * @param ph Program handle
+ * @param token Cancellation token
+ * @return        True on success. False on failure or cancellation
+ *
+ * @see GECancellationToken
+ * @see executeProgram(ProgramHandle_t*, int)
+ */
+bool GAUSS::executeProgram(ProgramHandle_t *ph, GECancellationToken *token) {
+    if (!token)
+        return executeProgram(ph);
+
+    if (!ph || !token->attach())
+        return false;
+
+    bool ret = executeProgram(ph);
+
+    token->detach();
+
+    return ret;
+}
+
+/**
+ * Gets the workspace information saved in a file and
+ * returns it in a workspace handle. This also sets the loaded workspace
+ * to be the current workspace.
+ *
+ * If _loadWorkspace_ fails, _wh_ will be `null`. Use getError() to
+ * get the number of the error. _loadWorkspace_ may fail with either of
+ * the following errors:
+ *
+ * Error | Reason
+ * -----:|------------
+ * 30    | Insufficient memory.
+ * 495   | Workspace inactive or corrupt.
+ *
+ * @param gcgfile        name of file workspace is stored in
+ * @return        pointer to a workspace handle.
+ */
+GEWorkspace* GAUSS::loadWorkspace(std::string gcgfile) {
+    WorkspaceHandle_t *workspace = GAUSS_LoadWorkspace(removeConst(&gcgfile));
+
+    if (!workspace)
+        return nullptr;
+
+    GEWorkspace *newWh = new GEWorkspace(workspace);
+
+    updateWorkspaceName(newWh);
+
+    // set as active workspace
+    setActiveWorkspace(newWh);
+
+    return newWh;
+}
+
+/**
+ * Returns the current associated name of a workspace according to GAUSS
+ *
+ * @param workspace Workspace handle
+ * @return        Workspace name
+ *
+ * @see getActiveWorkspace()
+ */
+std::string GAUSS::getWorkspaceName(GEWorkspace *workspace) const {
+    if (!this->d->manager_->isValidWorkspace(workspace))
+        return std::string();
+
+    char name[1024];
+    memset(&name, 0, sizeof(name));
+
+    GAUSS_GetWorkspaceName(workspace->workspace(), name);
+
+    return std::string(name);
+}
+
+/**
+ * Request the workspace name from GAUSS, and set the _name_
+ * field in the GEWorkspace object.
+ *
+ * @param workspace        Workspace handle
+ *
+ * @see getWorkspaceName(GEWorkspace*)
+ */
+void GAUSS::updateWorkspaceName(GEWorkspace *workspace) {
+    std::string wkspName = getWorkspaceName(workspace);
+
+    workspace->setName(wkspName);
+}
+
+/**
+ * Free a program handle created by compileString(std::string),
+ * compileFile(std::string), and loadCompiledFile(std::string)
+ *
+ * @param ph        Program handle
+ *
+ * @see compileString(std::string)
+ * @see compileFile(std::string)
+ * @see loadCompiledFile(std::string)
+ * @see executeProgram(ProgramHandle_t*)
+ */
+void GAUSS::freeProgram(ProgramHandle_t *ph) {
+    this->d->removeProgram(ph);
+    GAUSS_FreeProgram(ph);
+}
+
+/**
+ * Returns the compiled-program cache used by executeString() and executeFile(). The cache
+ * is disabled by default; enable it with GEProgramCache::setMaxEntries().
+ *
+ * Example:
+ *
+__Python__
+```py
+cache = ge.getProgramCache()
+cache.setMaxEntries(500)
+ge.executeString("x = 1")
+ge.executeString("x = 1")
+print(cache.hits(), cache.misses())
+```
+ * will result in the output:
+```
+1 1
+```
+ *
+ * @return        Program cache object, owned by this object.
+ *
+ * @see executeString(std::string)
+ * @see executeFile(std::string)
+ */
+GEProgramCache* GAUSS::getProgramCache() const {
+    return this->d->programCache_;
+}
+
+/**
+ * Returns the pool of pre-created workspaces. The pool is empty by default; give it a size with
+ * GEWorkspacePool::setSize() before initialize() to have the workspaces created along with the
+ * engine. destroyAllWorkspaces() and shutdown() empty the pool until the next initialize().
+ *
+ * Example:
+ *
+__Python__
+```py
+pool = ge.getWorkspacePool()
+pool.setSize(4, 16)
+ge.initialize()
+
+wh = pool.acquire()
+ge.executeString("x = 5", wh)
+pool.release(wh)
+
+print(pool.available(), pool.inUse())
+```
+ * will result in the output:
+```
+4 0
+```
+ *
+ * @return        Workspace pool object, owned by this object.
+ *
+ * @see GEWorkspacePool::acquire(int)
+ * @see GEWorkspacePool::release(GEWorkspace*)
+ */
+GEWorkspacePool* GAUSS::getWorkspacePool() const {
+    return this->d->workspacePool_;
+}
+
+/**
+ * Call a procedure defined in the active workspace. The arguments and return values are passed
+ * directly through _call_, without assigning globals or compiling code.
+ *
+ * @param call        Procedure name and arguments. Receives the return values.
+ * @return        True on success, false on failure
+ *
+ * @see callProc(GEProcCall*, GEWorkspace*)
+ * @see callProc(ProgramHandle_t*, GEProcCall*)
+ */
+bool GAUSS::callProc(GEProcCall *call) {
+    return callProc(call, getActiveWorkspace());
+}
+
+/**
+ * Call a procedure defined in a specific workspace. The arguments and return values are passed
+ * directly through _call_, without assigning globals or compiling code.
+ *
+ * @param call        Procedure name and arguments. Receives the return values.
+ * @param workspace    Workspace handle
+ * @return        True on success, false on failure
+ *
+ * @see callProc(GEProcCall*)
+ * @see callProc(ProgramHandle_t*, GEProcCall*)
+ */
+bool GAUSS::callProc(GEProcCall *call, GEWorkspace *workspace) {
+    if (!call || !this->d->manager_->isValidWorkspace(workspace))
+        return false;
+
+    ProgramHandle_t *ph = this->d->addProgram(GAUSS_CreateProgram(workspace->workspace(), 0), workspace);
+
+    if (!ph)
+        return false;
+
+    bool ret = callProc(ph, call);
+
+    freeProgram(ph);
+
+    return ret;
+}
+
+/**
+ * Call a procedure in the context of a program, such as one created with compileString(std::string)
+ * that defines the procedure. The arguments are handed to GAUSS_CallProc() directly, and the
+ * return values are moved into _call_ without copying.
+ *
+ * Example:
+ *
+__Python__
+```py
+ph = ge.compileString("proc (1) = scale(x, s); retp(x * s); endp;")
+ge.executeProgram(ph)
+
+call = GEProcCall("scale")
+call.setKeepArgs(True)
+call.addArg(GEMatrix([1.0, 2.0], 1, 2))
+call.addArg(10.0)
+
+for i in range(0, 3):
+    ge.callProc(ph, call)
+
+print(list(call.getReturn(0).getData()))
+```
+ * will result in the output:
+```
+[10.0, 20.0]
+```
+ *
+ * @param ph        Program handle
+ * @param call        Procedure name and arguments. Receives the return values.
+ * @return        True on success, false on failure
+ *
+ * @see callProc(GEProcCall*)
+ * @see GEProcCall
+ */
+bool GAUSS::callProc(ProgramHandle_t *ph, GEProcCall *call) {
+    if (!ph || !call || call->name().empty())
+        return false;
+
+    call->clearReturns();
+
+    ArgList_t *args = call->argList();
+
+    if (!args)
+        return false;
+
+    // Setup output hook
+    ensureHooks();
+
+    // Procedure may reassign globals, invalidating outstanding views
+    this->d->touchProgram(ph);
+
+    ArgList_t *ret = nullptr;
+
+    if (call->keepArgs()) {
+        ret = GAUSS_CallProc(ph, removeConst(&call->name_), args);
+    } else {
+        // The engine frees the argument list
+        call->args_ = nullptr;
+        ret = GAUSS_CallProcFreeArgs(ph, removeConst(&call->name_), args);
+    }
+
+    if (!ret)
+        return false;
+
+    call->setReturns(ret);
+
+    return true;
+}
+
+/**
+ * Execute a command in the active workspace on a background thread. Equivalent to
+ * executeStringAsync(std::string, GEWorkspace*) with the workspace that is active at the
+ * time of the call.
+ *
+ * @param command        Expression to execute.
+ * @return        Future that becomes ready with the result of executeString(std::string, GEWorkspace*)
+ *
+ * @see executeStringAsync(std::string, GEWorkspace*)
+ */
+std::future<bool> GAUSS::executeStringAsync(std::string command) {
+    return executeStringAsync(command, getActiveWorkspace());
+}
+
+/**
+ * Execute a command in a specific workspace on a background thread, and return immediately.
+ *
+ * Jobs run on an internal pool of worker threads. Jobs queued for the same workspace run one
+ * at a time in the order they were queued, while jobs for different workspaces run in parallel.
+ * The caller must not use the workspace directly until the job has finished.
+ *
+ * Program output is collected per thread. With managed output enabled, the output of
+ * asynchronous jobs is discarded; install a callback with setProgramOutputAll(IGEProgramOutput*)
+ * to receive it.
+ *
+ * Example (C++):
+ *
+```cpp
+GEWorkspace *wh1 = ge.createWorkspace("wh1");
+GEWorkspace *wh2 = ge.createWorkspace("wh2");
+
+std::future<bool> f1 = ge.executeStringAsync("x = inv(rndn(500, 500))", wh1);
+std::future<bool> f2 = ge.executeStringAsync("y = inv(rndn(500, 500))", wh2);
+
+prepareNextRequest();
+
+if (f1.get() && f2.get())
+    std::cout << ge.getMatrix("x", wh1)->getRows() << std::endl;
+```
+ *
+ * @param command        Expression to execute.
+ * @param workspace        Workspace handle
+ * @return        Future that becomes ready with the result of executeString(std::string, GEWorkspace*)
+ *
+ * @see executeStringAsync(std::string, GEWorkspace*, std::function<void(bool)>)
+ * @see waitForAsync()
+ */
+std::future<bool> GAUSS::executeStringAsync(std::string command, GEWorkspace *workspace) {
+    std::shared_ptr<std::promise<bool> > promise = std::make_shared<std::promise<bool> >();
+    std::future<bool> result = promise->get_future();
+
+    executeStringAsync(command, workspace, [promise](bool success) { promise->set_value(success); });
+
+    return result;
+}
+
+/**
+ * Execute a command in a specific workspace on a background thread, and call _callback_ with the
+ * result when it finishes. The callback runs on the worker thread. If _workspace_ is not valid, it
+ * is called with `false` before this function returns. If executing throws, it is called with
+ * `false`; an exception thrown by the callback itself is discarded.
+ *
+ * The callback runs while its job still occupies the workspace queue, so it cannot wait for
+ * asynchronous jobs: waitForAsync() returns immediately, setAsyncThreadCount(int) has no effect
+ * and destroyWorkspace(GEWorkspace*) fails for a workspace with queued jobs when called from it.
+ *
+ * @param command        Expression to execute.
+ * @param workspace        Workspace handle
+ * @param callback        Called with the result of executeString(std::string, GEWorkspace*)
+ *
+ * @see executeStringAsync(std::string, GEWorkspace*)
+ */
+void GAUSS::executeStringAsync(std::string command, GEWorkspace *workspace, std::function<void(bool)> callback) {
+    if (!this->d->manager_->isValidWorkspace(workspace)) {
+        if (callback)
+            callback(false);
+
+        return;
+    }
+
+    this->d->postAsync(workspace->workspace(), [this, command, workspace, callback]() {
+        bool ret = false;
+
+        // The callback must run whatever happens, or a future waiting on it is never ready
+        try {
+            ret = this->executeString(command, workspace);
+        } catch (...) {
+        }
+
+        if (callback)
+            callback(ret);
+    });
+}
+
+/**
+ * Execute a program on a background thread. The program must have been compiled in the
+ * active workspace.
+ *
+ * @param ph        Program handle
+ * @return        Future that becomes ready with the result of executeProgram(ProgramHandle_t*)
+ *
+ * @see executeProgramAsync(ProgramHandle_t*, GEWorkspace*)
+ */
+std::future<bool> GAUSS::executeProgramAsync(ProgramHandle_t *ph) {
+    return executeProgramAsync(ph, getActiveWorkspace());
+}
+
+/**
+ * Execute a program on a background thread, and return immediately. _workspace_ must be the
+ * workspace the program was compiled in; it is used to serialize jobs, so two programs for the
+ * same workspace never execute at the same time. The program handle must stay valid until
+ * the job has finished.
+ *
+ * Example (C++):
+ *
+```cpp
+ProgramHandle_t *ph = ge.compileString("x = x + 1", wh);
+std::vector<std::future<bool> > results;
+
+for (int i = 0; i < 10; ++i)
+    results.push_back(ge.executeProgramAsync(ph, wh));   // runs in order
+
+for (size_t i = 0; i < results.size(); ++i)
+    results[i].get();
+
+ge.freeProgram(ph);
+```
+ *
+ * @param ph        Program handle
+ * @param workspace        Workspace handle the program was compiled in
+ * @return        Future that becomes ready with the result of executeProgram(ProgramHandle_t*)
+ *
+ * @see executeStringAsync(std::string, GEWorkspace*)
+ */
+std::future<bool> GAUSS::executeProgramAsync(ProgramHandle_t *ph, GEWorkspace *workspace) {
+    std::shared_ptr<std::promise<bool> > promise = std::make_shared<std::promise<bool> >();
+    std::future<bool> result = promise->get_future();
+
+    executeProgramAsync(ph, workspace, [promise](bool success) { promise->set_value(success); });
+
+    return result;
+}
+
+/**
+ * Execute a program on a background thread, and call _callback_ with the result when it finishes.
+ * The callback runs on the worker thread. If _ph_ or _workspace_ is not valid, it is called with
+ * `false` before this function returns.
+ *
+ * @param ph        Program handle
+ * @param workspace        Workspace handle the program was compiled in
+ * @param callback        Called with the result of executeProgram(ProgramHandle_t*)
+ *
+ * @see executeProgramAsync(ProgramHandle_t*, GEWorkspace*)
+ */
+void GAUSS::executeProgramAsync(ProgramHandle_t *ph, GEWorkspace *workspace, std::function<void(bool)> callback) {
+    if (!ph || !this->d->manager_->isValidWorkspace(workspace)) {
+        if (callback)
+            callback(false);
+
+        return;
+    }
+
+    this->d->postAsync(workspace->workspace(), [this, ph, callback]() {
+        bool ret = false;
+
+        try {
+            ret = this->executeProgram(ph);
+        } catch (...) {
+        }
+
+        if (callback)
+            callback(ret);
+    });
+}
+
+/**
+ * Copy a matrix from the active workspace on a background thread.
+ *
+ * @param name        Name of GAUSS symbol
+ * @return        Future that becomes ready with the result of getMatrix(std::string, GEWorkspace*)
+ *
+ * @see getMatrixAsync(std::string, GEWorkspace*)
+ */
+std::future<GEMatrix*> GAUSS::getMatrixAsync(std::string name) {
+    return getMatrixAsync(name, getActiveWorkspace());
+}
+
+/**
+ * Copy a matrix from a specific workspace on a background thread. The copy is queued behind any
+ * asynchronous jobs already queued for _workspace_, so it sees their results. The caller owns the
+ * returned matrix.
+ *
+ * @param name        Name of GAUSS symbol
+ * @param workspace        Workspace handle
+ * @return        Future that becomes ready with the result of getMatrix(std::string, GEWorkspace*)
+ *
+ * @see executeStringAsync(std::string, GEWorkspace*)
+ */
+std::future<GEMatrix*> GAUSS::getMatrixAsync(std::string name, GEWorkspace *workspace) {
+    std::shared_ptr<std::promise<GEMatrix*> > promise = std::make_shared<std::promise<GEMatrix*> >();
+    std::future<GEMatrix*> result = promise->get_future();
+
+    getMatrixAsync(name, workspace, [promise](GEMatrix *matrix) { promise->set_value(matrix); });
+
+    return result;
+}
+
+/**
+ * Copy a matrix from a specific workspace on a background thread, and call _callback_ with it
+ * when done. The callback runs on the worker thread and takes ownership of the matrix, which is
+ * `nullptr` if the symbol could not be found. If _workspace_ is not valid, it is called with
+ * `nullptr` before this function returns.
+ *
+ * @param name        Name of GAUSS symbol
+ * @param workspace        Workspace handle
+ * @param callback        Called with the result of getMatrix(std::string, GEWorkspace*)
+ */
+void GAUSS::getMatrixAsync(std::string name, GEWorkspace *workspace, std::function<void(GEMatrix*)> callback) {
+    if (!this->d->manager_->isValidWorkspace(workspace)) {
+        if (callback)
+            callback(nullptr);
+
+        return;
+    }
+
+    this->d->postAsync(workspace->workspace(), [this, name, workspace, callback]() {
+        GEMatrix *matrix = nullptr;
+
+        try {
+            matrix = this->getMatrix(name, workspace);
+        } catch (...) {
+        }
+
+        if (callback)
+            callback(matrix);
+        else
+            delete matrix;
+    });
+}
+
+/**
+ * Block until every queued asynchronous job has finished. When called from an asynchronous job or
+ * callback, which would wait for itself, it returns immediately.
+ *
+ * @see waitForAsync(GEWorkspace*)
+ */
+void GAUSS::waitForAsync() {
+    std::shared_ptr<GEWorkerPool> pool = this->d->workerPool(false);
+
+    if (pool)
+        pool->waitAll();
+}
+
+/**
+ * Block until every asynchronous job queued for _workspace_ has finished. When called from an
+ * asynchronous job or callback while jobs are queued for _workspace_, it returns immediately.
+ *
+ * @param workspace        Workspace handle
+ */
+void GAUSS::waitForAsync(GEWorkspace *workspace) {
+    std::shared_ptr<GEWorkerPool> pool = this->d->workerPool(false);
+
+    if (pool && workspace)
+        pool->wait(workspace->workspace());
+}
+
+/**
+ * Set the number of worker threads used for asynchronous execution. By default one thread per
+ * hardware core is used. If the pool is already running, queued jobs are finished first and the
+ * new size applies to the next job. Has no effect when called from an asynchronous job or
+ * callback, since the pool cannot stop the thread it is running on.
+ *
+ * @param count        Number of threads, or `0` for the default
+ */
+void GAUSS::setAsyncThreadCount(int count) {
+    std::shared_ptr<GEWorkerPool> pool = this->d->workerPool(false);
+
+    if (pool && pool->isWorkerThread())
+        return;
+
+    pool.reset();
+    this->d->stopAsync();
+
+    std::lock_guard<std::mutex> guard(this->d->workerMutex_);
+    this->d->workerThreads_ = count > 0 ? count : 0;
+}
+
+/**
+ * Return the number of worker threads used for asynchronous execution.
+ */
+int GAUSS::asyncThreadCount() const {
+    std::lock_guard<std::mutex> guard(this->d->workerMutex_);
+
+    if (this->d->workerThreads_ > 0)
+        return this->d->workerThreads_;
+
+    int cores = std::thread::hardware_concurrency();
+
+    return cores > 0 ? cores : 1;
+}
 
 /**
  * Returns the type of a symbol in the active GAUSS workspace or 0 if it cannot find the symbol.
@@ -1137,44 +2467,151 @@ bool GAUSS::_setSymbol(GESymbol *symbol, std::string name, GEWorkspace *workspac
     }
 }
 
-bool GAUSS::setScalar(double value, std::string name, GEWorkspace *workspace) {
-    if (name.empty() || !this->d->manager_->isValidWorkspace(workspace))
-        return false;
+bool GAUSS::setScalar(double value, std::string name, GEWorkspace *workspace) {
+    if (name.empty() || !this->d->manager_->isValidWorkspace(workspace))
+        return false;
+
+    workspace->touch();
+
+    int ret = GAUSS_PutDouble(workspace->workspace(), value, removeConst(&name));
+
+    return (ret == GAUSS_SUCCESS);
+}
+
+bool GAUSS::setScalar(double value, std::string name) {
+    return setScalar(value, name, getActiveWorkspace());
+}
+
+GESymbol* GAUSS::getSymbol(std::string name) const {
+    return getSymbol(name, getActiveWorkspace());
+}
+
+GESymbol* GAUSS::getSymbol(std::string name, GEWorkspace *workspace) const {
+    if (name.empty() || !this->d->manager_->isValidWorkspace(workspace))
+        return 0;
+
+    return this->d->fetchSymbol(workspace->workspace(), name);
+}
+
+/**
+ * Retrieve several symbols from the active workspace in one call. The workspace is validated
+ * once and each name is looked up directly, so this is cheaper than repeated calls to
+ * getSymbol(std::string) when many results are needed.
+ *
+ * Example:
+ *
+__Python__
+```py
+ge.executeString("b = { 1, 2 }; s = \"ok\"; a = areshape(seqa(1,1,8), 2|2|2)")
+syms = ge.getSymbols(["b", "s", "a", "missing"])
+print(sorted(syms.keys()))
+print(list(syms["b"].getData()))
+```
+ * will result in the output:
+```
+['a', 'b', 's']
+[1.0, 2.0]
+```
+ *
+ * @param names        Names of GAUSS symbols
+ * @return        Map of symbol name to a copy of the symbol. Names that do not exist or have an
+ *                unsupported type are left out. The caller takes ownership of the symbols.
+ *
+ * @see getSymbols(const std::vector<std::string>&, GEWorkspace*)
+ * @see setSymbols(const std::map<std::string, GESymbol*>&)
+ * @see getSymbol(std::string)
+ */
+std::map<std::string, GESymbol*> GAUSS::getSymbols(const std::vector<std::string> &names) const {
+    return getSymbols(names, getActiveWorkspace());
+}
+
+/**
+ * Retrieve several symbols from workspace _workspace_ in one call. The workspace is validated
+ * once and each name is looked up directly, so this is cheaper than repeated calls to
+ * getSymbol(std::string, GEWorkspace*) when many results are needed.
+ *
+ * @param names        Names of GAUSS symbols
+ * @param workspace    Workspace handle
+ * @return        Map of symbol name to a copy of the symbol. Names that do not exist or have an
+ *                unsupported type are left out. The caller takes ownership of the symbols.
+ *
+ * @see getSymbols(const std::vector<std::string>&)
+ * @see setSymbols(const std::map<std::string, GESymbol*>&, GEWorkspace*)
+ * @see getSymbol(std::string, GEWorkspace*)
+ */
+std::map<std::string, GESymbol*> GAUSS::getSymbols(const std::vector<std::string> &names, GEWorkspace *workspace) const {
+    std::map<std::string, GESymbol*> ret;
 
-    int ret = GAUSS_PutDouble(workspace->workspace(), value, removeConst(&name));
+    if (!this->d->manager_->isValidWorkspace(workspace))
+        return ret;
 
-    return (ret == GAUSS_SUCCESS);
-}
+    WorkspaceHandle_t *wh = workspace->workspace();
 
-bool GAUSS::setScalar(double value, std::string name) {
-    return setScalar(value, name, getActiveWorkspace());
+    for (size_t i = 0; i < names.size(); ++i) {
+        const std::string &name = names[i];
+
+        if (name.empty() || ret.count(name))
+            continue;
+
+        GESymbol *symbol = this->d->fetchSymbol(wh, name);
+
+        if (symbol)
+            ret[name] = symbol;
+    }
+
+    return ret;
 }
 
-GESymbol* GAUSS::getSymbol(std::string name) const {
-    return getSymbol(name, getActiveWorkspace());
+/**
+ * Add several symbols to the active workspace in one call. Each symbol is copied into the
+ * symbol table under its map key, exactly as setSymbol() would.
+ *
+ * Example:
+ *
+__Python__
+```py
+ge.setSymbols({ "x": GEMatrix([1.0, 2.0, 3.0, 4.0], 2, 2), "s": GEStringArray(["a", "b"], 1, 2) })
+ge.executeString("print x s")
+```
+ *
+ * @param symbols        Map of symbol name to symbol
+ * @return        True if every symbol was added, false if any failed. A failure does not stop
+ *                the remaining symbols from being added.
+ *
+ * @see setSymbols(const std::map<std::string, GESymbol*>&, GEWorkspace*)
+ * @see getSymbols(const std::vector<std::string>&)
+ */
+bool GAUSS::setSymbols(const std::map<std::string, GESymbol*> &symbols) {
+    return setSymbols(symbols, getActiveWorkspace());
 }
 
-GESymbol* GAUSS::getSymbol(std::string name, GEWorkspace *workspace) const {
-    if (name.empty() || !this->d->manager_->isValidWorkspace(workspace))
-        return 0;
+/**
+ * Add several symbols to workspace _workspace_ in one call. Each symbol is copied into the
+ * symbol table under its map key, exactly as setSymbol() would.
+ *
+ * @param symbols        Map of symbol name to symbol
+ * @param workspace    Workspace handle
+ * @return        True if every symbol was added, false if any failed. A failure does not stop
+ *                the remaining symbols from being added.
+ *
+ * @see setSymbols(const std::map<std::string, GESymbol*>&)
+ * @see getSymbols(const std::vector<std::string>&, GEWorkspace*)
+ */
+bool GAUSS::setSymbols(const std::map<std::string, GESymbol*> &symbols, GEWorkspace *workspace) {
+    if (!this->d->manager_->isValidWorkspace(workspace))
+        return false;
 
-    int type = getSymbolType(name, workspace);
+    WorkspaceHandle_t *wh = workspace->workspace();
+    bool ret = true;
 
-    switch (type) {
-    case GESymType::SCALAR:
-    case GESymType::MATRIX:
-        return getMatrix(name, workspace);
-        break;
-    case GESymType::ARRAY_GAUSS:
-        return getArray(name, workspace);
-        break;
-    case GESymType::STRING:
-    case GESymType::STRING_ARRAY:
-        return getStringArray(name, workspace);
-        break;
-    default:
-        return nullptr;
+    workspace->touch();
+
+    for (std::map<std::string, GESymbol*>::const_iterator it = symbols.begin(); it != symbols.end(); ++it) {
+        if (!this->d->storeSymbol(wh, it->second, it->first))
+            ret = false;
     }
+
+    return ret;
 }
 
 /**
@@ -1450,6 +2887,8 @@ GEMatrix* GAUSS::getMatrixAndClear(std::string name, GEWorkspace *workspace) con
     if (!this->d->manager_->isValidWorkspace(workspace))
         return nullptr;
 
+    workspace->touch();
+
     Matrix_t *gsMat = GAUSS_GetMatrixAndClear(workspace->workspace(), removeConst(&name));
 
     if (gsMat == nullptr)
@@ -1491,6 +2930,7 @@ x =        0.0000000
 * @return        Matrix object
 *
 * @see getMatrixDirect(std::string, GEWorkspace*)
+* @see getMatrixView(std::string)
 * @see setSymbol(GEMatrix*, std::string)
 * @see setSymbol(GEMatrix*, std::string, GEWorkspace*)
 * @see getMatrix(std::string)
@@ -1539,6 +2979,7 @@ x =        0.0000000
 * @return        Matrix object
 *
 * @see getMatrixDirect(std::string)
+* @see getMatrixView(std::string, GEWorkspace*)
 * @see setSymbol(GEMatrix*, std::string)
 * @see setSymbol(GEMatrix*, std::string, GEWorkspace*)
 * @see getMatrix(std::string)
@@ -1559,6 +3000,94 @@ doubleArray* GAUSS::getMatrixDirect(std::string name, GEWorkspace* workspace) {
     return new doubleArray(info.maddr, info.rows, info.cols);
 }
 
+/**
+ * Retrieve a read-only view of a matrix from the GAUSS symbol name in the active workspace. Unlike
+ * getMatrix(std::string), no data is copied: the view references the symbol table memory directly.
+ *
+ * The view is invalidated when the workspace is freed or the symbol is reassigned, after which
+ * GEMatrixView::isValid() returns false and element access returns `0`.
+ *
+ * Example:
+ *
+__Python__
+```py
+ge.executeString("x = { 1 2, 3 4 }")
+xv = ge.getMatrixView("x")
+print("x[1,0] = " + str(xv.getElement(1, 0)))
+```
+ *
+__PHP__
+```php
+$ge->executeString("x = { 1 2, 3 4 }");
+$xv = $ge->getMatrixView("x");
+echo "x[1,0] = " . $xv->getElement(1, 0) . PHP_EOL;
+```
+ * will result in the output:
+```
+x[1,0] = 3
+```
+ *
+ * @param name        Name of GAUSS symbol
+ * @return        Matrix view object
+ *
+ * @see getMatrixView(std::string, GEWorkspace*)
+ * @see getMatrix(std::string)
+ * @see getMatrixDirect(std::string)
+ */
+GEMatrixView* GAUSS::getMatrixView(std::string name) const {
+    return getMatrixView(name, getActiveWorkspace());
+}
+
+/**
+ * Retrieve a read-only view of a matrix from the GAUSS symbol name in workspace _wh_. Unlike
+ * getMatrix(std::string, GEWorkspace*), no data is copied: the view references the symbol table memory directly.
+ *
+ * The view is invalidated when the workspace is freed or the symbol is reassigned, after which
+ * GEMatrixView::isValid() returns false and element access returns `0`.
+ *
+ * Example:
+ *
+ * Given _myWorkspace_ is a GEWorkspace object
+ *
+__Python__
+```py
+ge.executeString("x = { 1 2, 3 4 }", myWorkspace)
+xv = ge.getMatrixView("x", myWorkspace)
+print("x[1,0] = " + str(xv.getElement(1, 0)))
+```
+ *
+__PHP__
+```php
+$ge->executeString("x = { 1 2, 3 4 }", $myWorkspace);
+$xv = $ge->getMatrixView("x", $myWorkspace);
+echo "x[1,0] = " . $xv->getElement(1, 0) . PHP_EOL;
+```
+ * will result in the output:
+```
+x[1,0] = 3
+```
+ *
+ * @param name        Name of GAUSS symbol
+ * @param workspace    Workspace handle
+ * @return        Matrix view object
+ *
+ * @see getMatrixView(std::string)
+ * @see getMatrix(std::string, GEWorkspace*)
+ * @see getMatrixDirect(std::string, GEWorkspace*)
+ */
+GEMatrixView* GAUSS::getMatrixView(std::string name, GEWorkspace *workspace) const {
+    if (!this->d->manager_->isValidWorkspace(workspace))
+        return nullptr;
+
+    GAUSS_MatrixInfo_t info;
+    int ret = GAUSS_GetMatrixInfo(workspace->workspace(), &info, removeConst(&name));
+
+    if (ret)
+        return nullptr;
+
+    return new GEMatrixView(info, name, workspace);
+}
+
 bool GAUSS::_setSymbol(doubleArray *data, std::string name) {
     return _setSymbol(data, name, getActiveWorkspace());
 }
@@ -1656,6 +3185,8 @@ GEArray* GAUSS::getArrayAndClear(std::string name, GEWorkspace *workspace) const
     if (!this->d->manager_->isValidWorkspace(workspace))
         return nullptr;
 
+    workspace->touch();
+
     Array_t *gsArray = GAUSS_GetArrayAndClear(workspace->workspace(), removeConst(&name));
 
     if (gsArray == nullptr)
@@ -1795,40 +3326,320 @@ x = GEMatrix(5.0)
 ge.setSymbol(x, "x", myWorkspace)
 ```
  *
-__PHP__
-```php
-$x = new GEMatrix(5);
-$ge->setSymbol($x, "x", $myWorkspace);
-```
+__PHP__
+```php
+$x = new GEMatrix(5);
+$ge->setSymbol($x, "x", $myWorkspace);
+```
+ *
+ *
+ * @param matrix    Matrix object to store in GAUSS symbol table
+ * @param name      Name to give newly added symbol
+ * @param workspace    Workspace handle
+ * @return          True on success, false on failure
+ *
+ * @see setSymbol(GEMatrix*, std::string)
+ * @see getMatrix(std::string)
+ * @see getMatrixAndClear(std::string)
+ * @see getScalar(std::string)
+ */
+bool GAUSS::setSymbol(GEMatrix *matrix, std::string name, GEWorkspace *workspace) {
+    if (!matrix || name.empty())
+        return false;
+
+    if (!this->d->manager_->isValidWorkspace(workspace))
+        return false;
+
+    workspace->touch();
+
+    return this->d->storeMatrix(workspace->workspace(), matrix, name);
+}
+
+/**
+ * Add a matrix to the active workspace with the specified symbol name, reading
+ * directly from _data_. The data is copied once, into memory owned by the symbol table.
+ * It should be in row-major order; if _is_complex_ is __true__, all the real values are
+ * followed by all the imaginary values.
+ *
+ * From Python this accepts any C-contiguous object supporting the buffer protocol with
+ * double precision elements, such as a numpy.ndarray, array.array('d') or memoryview.
+ * One-dimensional buffers are added as a single row, and three-dimensional buffers with a leading
+ * dimension of `2` are added as complex data.
+ *
+ * Example:
+ *
+__Python__
+```py
+import numpy as np
+x = np.arange(6, dtype=np.float64).reshape(2, 3)
+ge.setSymbol(x, "x")
+ge.executeString("print x")
+```
+ * will result in the output:
+```
+       0.0000000        1.0000000        2.0000000
+       3.0000000        4.0000000        5.0000000
+```
+ *
+ * @param data      Pointer to _rows_ * _cols_ elements, or twice that if _is_complex_ is true
+ * @param rows      Row count
+ * @param cols      Column count
+ * @param is_complex   True if data contains complex data, False otherwise
+ * @param name      Name to give newly added symbol
+ * @return          True on success, false on failure
+ *
+ * @see setSymbol(const double*, int, int, bool, std::string, GEWorkspace*)
+ * @see moveMatrix(const double*, int, int, bool, std::string)
+ * @see setSymbol(GEMatrix*, std::string)
+ */
+bool GAUSS::setSymbol(const double *data, int rows, int cols, bool is_complex, std::string name) {
+    return setSymbol(data, rows, cols, is_complex, name, getActiveWorkspace());
+}
+
+/**
+ * Add a matrix to a specific workspace with the specified symbol name, reading
+ * directly from _data_. The data is copied once, into memory owned by the symbol table.
+ * It should be in row-major order; if _is_complex_ is __true__, all the real values are
+ * followed by all the imaginary values.
+ *
+ * From Python this accepts any C-contiguous object supporting the buffer protocol with
+ * double precision elements, such as a numpy.ndarray, array.array('d') or memoryview.
+ * One-dimensional buffers are added as a single row, and three-dimensional buffers with a leading
+ * dimension of `2` are added as complex data.
+ *
+ * Example:
+ *
+ * Given _myWorkspace_ is a GEWorkspace object
+ *
+__Python__
+```py
+import array
+x = array.array('d', [1.0, 2.0, 3.0])
+ge.setSymbol(x, "x", myWorkspace)
+ge.executeString("print x", myWorkspace)
+```
+ * will result in the output:
+```
+       1.0000000        2.0000000        3.0000000
+```
+ *
+ * @param data      Pointer to _rows_ * _cols_ elements, or twice that if _is_complex_ is true
+ * @param rows      Row count
+ * @param cols      Column count
+ * @param is_complex   True if data contains complex data, False otherwise
+ * @param name      Name to give newly added symbol
+ * @param workspace    Workspace handle
+ * @return          True on success, false on failure
+ *
+ * @see setSymbol(const double*, int, int, bool, std::string)
+ * @see moveMatrix(const double*, int, int, bool, std::string, GEWorkspace*)
+ * @see setSymbol(GEMatrix*, std::string, GEWorkspace*)
+ */
+bool GAUSS::setSymbol(const double *data, int rows, int cols, bool is_complex, std::string name, GEWorkspace *workspace) {
+    if (!data || rows < 1 || cols < 1 || name.empty())
+        return false;
+
+    if (!this->d->manager_->isValidWorkspace(workspace))
+        return false;
+
+    workspace->touch();
+
+    // Alias the caller's memory, the engine makes the only copy.
+    Matrix_t mat;
+    mat.mdata = const_cast<double*>(data);
+    mat.rows = rows;
+    mat.cols = cols;
+    mat.complex = is_complex;
+    mat.freeable = FALSE;
+
+    return (GAUSS_CopyMatrixToGlobal(workspace->workspace(), &mat, removeConst(&name)) == GAUSS_SUCCESS);
+}
+
+/**
+ * Add a matrix to the active workspace with the specified symbol name, reading
+ * _data_ in the given _layout_. Column-major data is transposed while it is copied
+ * into memory owned by the symbol table, so no further copies are made.
+ *
+ * From Python, C-contiguous and Fortran-contiguous buffers are both accepted, and the layout is
+ * detected from the buffer.
+ *
+ * Example:
+ *
+__Python__
+```py
+import numpy as np
+x = np.asfortranarray(np.arange(6.0).reshape(2, 3))
+ge.setSymbol(x, "x")
+ge.executeString("print x")
+```
+ * will result in the output:
+```
+       0.0000000        1.0000000        2.0000000
+       3.0000000        4.0000000        5.0000000
+```
+ *
+ * @param data      Pointer to _rows_ * _cols_ elements, or twice that if _is_complex_ is true
+ * @param rows      Row count
+ * @param cols      Column count
+ * @param is_complex   True if data contains complex data, False otherwise
+ * @param layout    GELayout::ROW_MAJOR or GELayout::COL_MAJOR
+ * @param name      Name to give newly added symbol
+ * @return          True on success, false on failure
+ *
+ * @see setSymbol(const double*, int, int, bool, int, std::string, GEWorkspace*)
+ * @see getMatrixData(std::string, double*, size_t, int)
+ */
+bool GAUSS::setSymbol(const double *data, int rows, int cols, bool is_complex, int layout, std::string name) {
+    return setSymbol(data, rows, cols, is_complex, layout, name, getActiveWorkspace());
+}
+
+/**
+ * Add a matrix to a specific workspace with the specified symbol name, reading
+ * _data_ in the given _layout_. Column-major data is transposed while it is copied
+ * into memory owned by the symbol table, so no further copies are made.
+ *
+ * @param data      Pointer to _rows_ * _cols_ elements, or twice that if _is_complex_ is true
+ * @param rows      Row count
+ * @param cols      Column count
+ * @param is_complex   True if data contains complex data, False otherwise
+ * @param layout    GELayout::ROW_MAJOR or GELayout::COL_MAJOR
+ * @param name      Name to give newly added symbol
+ * @param workspace    Workspace handle
+ * @return          True on success, false on failure
+ *
+ * @see setSymbol(const double*, int, int, bool, int, std::string)
+ * @see getMatrixData(std::string, double*, size_t, int, GEWorkspace*)
+ */
+bool GAUSS::setSymbol(const double *data, int rows, int cols, bool is_complex, int layout, std::string name, GEWorkspace *workspace) {
+    if (layout == GELayout::ROW_MAJOR)
+        return setSymbol(data, rows, cols, is_complex, name, workspace);
+    else if (layout != GELayout::COL_MAJOR)
+        return false;
+
+    if (!data || rows < 1 || cols < 1 || name.empty() || !this->d->manager_->isValidWorkspace(workspace))
+        return false;
+
+    size_t elements = static_cast<size_t>(rows) * cols;
+    double *copy = static_cast<double*>(GAUSS_Malloc(elements * (is_complex ? 2 : 1) * sizeof(double)));
+
+    if (!copy)
+        return false;
+
+    // Column-major rows x cols is row-major cols x rows
+    transposeMatrix(data, copy, cols, rows);
+
+    if (is_complex)
+        transposeMatrix(data + elements, copy + elements, cols, rows);
+
+    workspace->touch();
+
+    int ret = GAUSS_AssignFreeableMatrix(workspace->workspace(), rows, cols, is_complex, copy, removeConst(&name));
+
+    return (ret == GAUSS_SUCCESS);
+}
+
+/**
+ * Copy a matrix from the GAUSS symbol name in the active workspace into _dest_, in the
+ * given _layout_. For column-major output the data is transposed as part of the copy.
+ * If the matrix is complex, all real values are followed by all imaginary values, each in _layout_ order.
+ *
+ * Example:
+ *
+__Python__
+```py
+import numpy as np
+ge.executeString("x = { 1 2 3, 4 5 6 }")
+x = np.asarray(ge.getMatrixData("x", GELayout.COL_MAJOR))
+print(x.flags.f_contiguous)
+```
+ * will result in the output:
+```
+True
+```
+ *
+ * @param name        Name of GAUSS symbol
+ * @param dest        Destination buffer
+ * @param dest_len    Number of elements available in _dest_
+ * @param layout      GELayout::ROW_MAJOR or GELayout::COL_MAJOR
+ * @return        True on success, false if the symbol is not a matrix or _dest_ is too small.
+ *
+ * @see getMatrixData(std::string, double*, size_t, int, GEWorkspace*)
+ * @see setSymbol(const double*, int, int, bool, int, std::string)
+ */
+bool GAUSS::getMatrixData(std::string name, double *dest, size_t dest_len, int layout) const {
+    return getMatrixData(name, dest, dest_len, layout, getActiveWorkspace());
+}
+
+/**
+ * Copy a matrix from the GAUSS symbol name in workspace _wh_ into _dest_, in the
+ * given _layout_. For column-major output the data is transposed as part of the copy.
+ * If the matrix is complex, all real values are followed by all imaginary values, each in _layout_ order.
+ *
+ * @param name        Name of GAUSS symbol
+ * @param dest        Destination buffer
+ * @param dest_len    Number of elements available in _dest_
+ * @param layout      GELayout::ROW_MAJOR or GELayout::COL_MAJOR
+ * @param workspace    Workspace handle
+ * @return        True on success, false if the symbol is not a matrix or _dest_ is too small.
  *
+ * @see getMatrixData(std::string, double*, size_t, int)
+ * @see setSymbol(const double*, int, int, bool, int, std::string, GEWorkspace*)
+ */
+bool GAUSS::getMatrixData(std::string name, double *dest, size_t dest_len, int layout, GEWorkspace *workspace) const {
+    if (!dest)
+        return false;
+
+    return getMatrixData(name, layout, workspace, [&](const GAUSS_MatrixInfo_t &info) -> double* {
+        size_t total = static_cast<size_t>(info.rows) * info.cols * (info.complex ? 2 : 1);
+        return dest_len < total ? nullptr : dest;
+    });
+}
+
+/**
+ * Copy a matrix from the GAUSS symbol name in workspace _wh_ into a buffer supplied by
+ * _allocate_, in the given _layout_. The symbol is looked up once, and _allocate_ is called with
+ * the matrix information the data is copied from, so the buffer always matches the copied shape.
+ * _allocate_ returns a buffer of at least `rows * cols` elements, doubled for complex matrices,
+ * or `nullptr` to cancel the copy.
  *
- * @param matrix    Matrix object to store in GAUSS symbol table
- * @param name      Name to give newly added symbol
+ * @param name        Name of GAUSS symbol
+ * @param layout      GELayout::ROW_MAJOR or GELayout::COL_MAJOR
  * @param workspace    Workspace handle
- * @return          True on success, false on failure
+ * @param allocate    Returns the destination buffer for the matrix
+ * @return        True on success, false if the symbol is not a matrix or _allocate_ returned `nullptr`.
  *
- * @see setSymbol(GEMatrix*, std::string)
- * @see getMatrix(std::string)
- * @see getMatrixAndClear(std::string)
- * @see getScalar(std::string)
+ * @see getMatrixData(std::string, double*, size_t, int, GEWorkspace*)
  */
-bool GAUSS::setSymbol(GEMatrix *matrix, std::string name, GEWorkspace *workspace) {
-    if (!matrix || name.empty())
+bool GAUSS::getMatrixData(std::string name, int layout, GEWorkspace *workspace, const std::function<double*(const GAUSS_MatrixInfo_t&)> &allocate) const {
+    if (layout != GELayout::ROW_MAJOR && layout != GELayout::COL_MAJOR)
         return false;
 
     if (!this->d->manager_->isValidWorkspace(workspace))
         return false;
 
-    int ret = 0;
+    GAUSS_MatrixInfo_t info;
 
-    if (!matrix->isComplex() && (matrix->getRows() == 1) && (matrix->getCols() == 1)) {
-        ret = GAUSS_PutDouble(workspace->workspace(), matrix->getElement(), removeConst(&name));
-    } else {
-        std::unique_ptr<Matrix_t> newMat(matrix->toInternal());
-        ret = GAUSS_CopyMatrixToGlobal(workspace->workspace(), newMat.get(), removeConst(&name));
+    if (GAUSS_GetMatrixInfo(workspace->workspace(), &info, removeConst(&name)))
+        return false;
+
+    size_t elements = static_cast<size_t>(info.rows) * info.cols;
+    size_t total = elements * (info.complex ? 2 : 1);
+    double *dest = allocate(info);
+
+    if (!dest)
+        return false;
+
+    if (layout == GELayout::ROW_MAJOR) {
+        memcpy(dest, info.maddr, total * sizeof(double));
+        return true;
     }
 
-    return (ret == GAUSS_SUCCESS);
+    transposeMatrix(info.maddr, dest, info.rows, info.cols);
+
+    if (info.complex)
+        transposeMatrix(info.maddr + elements, dest + elements, info.rows, info.cols);
+
+    return true;
 }
 
 /**
@@ -1905,12 +3716,9 @@ bool GAUSS::setSymbol(GEArray *array, std::string name, GEWorkspace *workspace)
     if (!this->d->manager_->isValidWorkspace(workspace))
         return false;
 
-    std::unique_ptr<Array_t> newArray(array->toInternal());
-
-    if (!newArray.get())
-        return false;
+    workspace->touch();
 
-    return (GAUSS_CopyArrayToGlobal(workspace->workspace(), newArray.get(), removeConst(&name)) == GAUSS_SUCCESS);
+    return this->d->storeArray(workspace->workspace(), array, name);
 }
 
 /**
@@ -1982,6 +3790,8 @@ bool GAUSS::setSymbol(std::string str, std::string name, GEWorkspace *workspace)
     if (!newStr)
         return false;
 
+    workspace->touch();
+
     return (GAUSS_MoveStringToGlobal(workspace->workspace(), newStr, removeConst(&name)) == GAUSS_SUCCESS);
 }
 
@@ -2049,19 +3859,15 @@ bool GAUSS::setSymbol(GEStringArray *sa, std::string name, GEWorkspace *workspac
     if (!this->d->manager_->isValidWorkspace(workspace))
         return false;
 
-    StringArray_t *newSa = sa->toInternal();
-
-    if (!newSa)
-        return false;
-
-    bool ret = (GAUSS_MoveStringArrayToGlobal(workspace->workspace(), newSa, removeConst(&name)) == GAUSS_SUCCESS);
+    workspace->touch();
 
-    return ret;
+    return this->d->storeStringArray(workspace->workspace(), sa, name);
 }
 
 /**
 * Add a matrix to the active workspace with the specified symbol name.
-* This implementation clears the local data after the move is completed.
+* The data is handed to the symbol table without a copy, and the local object is cleared
+* afterwards, regardless of the result.
 *
 * Example:
 *
@@ -2092,7 +3898,8 @@ bool GAUSS::moveSymbol(GEMatrix *matrix, std::string name) {
 
 /**
 * Add a matrix to a specific workspace with the specified symbol name.
-* This implementation clears the local data after the move is completed.
+* The data is handed to the symbol table without a copy, and the local object is cleared
+* afterwards, regardless of the result.
 *
 * Example:
 *
@@ -2122,16 +3929,33 @@ $ge->moveSymbol($x, "x", $myWorkspace);
 * @see getScalar(std::string)
 */
 bool GAUSS::moveSymbol(GEMatrix *matrix, std::string name, GEWorkspace *workspace) {
-    bool ret = setSymbol(matrix, name, workspace);
+    if (!matrix || name.empty() || !this->d->manager_->isValidWorkspace(workspace))
+        return false;
 
-    if (ret)
-        matrix->clear();
+    Matrix_t *newMat = GAUSS_MallocMatrix_t();
 
-    return ret;
+    if (!newMat)
+        return false;
+
+    newMat->rows = matrix->getRows();
+    newMat->cols = matrix->getCols();
+    newMat->complex = matrix->isComplex();
+    newMat->mdata = matrix->data_.release(); // Allocated with GAUSS_Malloc, the engine takes ownership
+    newMat->freeable = TRUE;
+
+    workspace->touch();
+
+    int ret = GAUSS_MoveMatrixToGlobal(workspace->workspace(), newMat, removeConst(&name));
+
+    matrix->clear();
+
+    return (ret == GAUSS_SUCCESS);
 }
 
 /**
 * Add an array to the active workspace with the specified symbol name.
+* The data is handed to the symbol table without a copy, and the local object is cleared
+* afterwards, regardless of the result.
 *
 * Example:
 *
@@ -2166,6 +3990,8 @@ bool GAUSS::moveSymbol(GEArray *array, std::string name) {
 
 /**
 * Add an array to a specific workspace with the specified symbol name.
+* The data is handed to the symbol table without a copy, and the local object is cleared
+* afterwards, regardless of the result.
 *
 * Example:
 *
@@ -2198,12 +4024,30 @@ $ge->moveSymbol($a, "a", $myWorkspace);
 * @see getArrayAndClear(std::string)
 */
 bool GAUSS::moveSymbol(GEArray *array, std::string name, GEWorkspace *workspace) {
-    bool ret = setSymbol(array, name, workspace);
+    if (!array || name.empty() || !this->d->manager_->isValidWorkspace(workspace))
+        return false;
 
-    if (ret)
-        array->clear();
+    if (!array->getDimensions() || !array->size())
+        return false;
 
-    return ret;
+    Array_t *newArray = GAUSS_MallocArray_t();
+
+    if (!newArray)
+        return false;
+
+    newArray->dims = array->getDimensions();
+    newArray->nelems = array->size();
+    newArray->complex = static_cast<int>(array->isComplex());
+    newArray->adata = array->data_.release(); // Orders followed by data, allocated with GAUSS_Malloc
+    newArray->freeable = TRUE;
+
+    workspace->touch();
+
+    int ret = GAUSS_MoveArrayToGlobal(workspace->workspace(), newArray, removeConst(&name));
+
+    array->clear();
+
+    return (ret == GAUSS_SUCCESS);
 }
 
 /**
@@ -2357,6 +4201,8 @@ bool GAUSS::moveMatrix(doubleArray *data, int rows, int cols, bool is_complex, s
     if (!data || name.empty() || !this->d->manager_->isValidWorkspace(workspace))
         return false;
 
+    workspace->touch();
+
     int ret = GAUSS_AssignFreeableMatrix(workspace->workspace(), rows, cols, is_complex, data->data(), removeConst(&name));
 
     data->reset();
@@ -2364,6 +4210,84 @@ bool GAUSS::moveMatrix(doubleArray *data, int rows, int cols, bool is_complex, s
     return (ret == GAUSS_SUCCESS);
 }
 
+/**
+* Add a matrix and give ownership to the active workspace with the specified symbol name.
+* The data is copied once into memory allocated with GAUSS_Malloc, which is then assigned to
+* the symbol table without further copies. The caller keeps ownership of _data_.
+*
+* From Python this accepts the same buffer objects as setSymbol(const double*, int, int, bool, std::string).
+*
+* Example:
+*
+__Python__
+```py
+import numpy as np
+x = np.ones((1000, 1000))
+ge.moveMatrix(x, "x")
+```
+*
+* @param data      Pointer to _rows_ * _cols_ elements, or twice that if _is_complex_ is true
+* @param rows      Row count
+* @param cols      Column count
+* @param is_complex   True if data contains complex data, False otherwise
+* @param name      Name to give newly added symbol
+* @return          True on success, false on failure
+*
+* @see moveMatrix(const double*, int, int, bool, std::string, GEWorkspace*)
+* @see setSymbol(const double*, int, int, bool, std::string)
+*/
+bool GAUSS::moveMatrix(const double *data, int rows, int cols, bool is_complex, std::string name) {
+    return moveMatrix(data, rows, cols, is_complex, name, getActiveWorkspace());
+}
+
+/**
+* Add a matrix and give ownership to a specific workspace with the specified symbol name.
+* The data is copied once into memory allocated with GAUSS_Malloc, which is then assigned to
+* the symbol table without further copies. The caller keeps ownership of _data_.
+*
+* From Python this accepts the same buffer objects as setSymbol(const double*, int, int, bool, std::string, GEWorkspace*).
+*
+* Example:
+*
+* Given _myWorkspace_ is a GEWorkspace object
+*
+__Python__
+```py
+import numpy as np
+x = np.ones((1000, 1000))
+ge.moveMatrix(x, "x", myWorkspace)
+```
+*
+* @param data      Pointer to _rows_ * _cols_ elements, or twice that if _is_complex_ is true
+* @param rows      Row count
+* @param cols      Column count
+* @param is_complex   True if data contains complex data, False otherwise
+* @param name      Name to give newly added symbol
+* @param workspace        Workspace to assign symbol to
+* @return          True on success, false on failure
+*
+* @see moveMatrix(const double*, int, int, bool, std::string)
+* @see setSymbol(const double*, int, int, bool, std::string, GEWorkspace*)
+*/
+bool GAUSS::moveMatrix(const double *data, int rows, int cols, bool is_complex, std::string name, GEWorkspace *workspace) {
+    if (!data || rows < 1 || cols < 1 || name.empty() || !this->d->manager_->isValidWorkspace(workspace))
+        return false;
+
+    size_t elements = static_cast<size_t>(rows) * cols * (is_complex ? 2 : 1);
+    double *copy = static_cast<double*>(GAUSS_Malloc(elements * sizeof(double)));
+
+    if (!copy)
+        return false;
+
+    memcpy(copy, data, elements * sizeof(double));
+
+    workspace->touch();
+
+    int ret = GAUSS_AssignFreeableMatrix(workspace->workspace(), rows, cols, is_complex, copy, removeConst(&name));
+
+    return (ret == GAUSS_SUCCESS);
+}
+
 /**
  * Translates a file that contains a dataloop, so it can be read by the compiler.
  * After translating a file, you can compile it with compileFile(std::string) and then
@@ -2420,13 +4344,28 @@ std::string GAUSS::getErrorOutput() {
 }
 
 void GAUSS::resetHooks() {
-    setHookProgramOutput(GAUSS::internalHookOutput);
-    setHookProgramErrorOutput(GAUSS::internalHookError);
-    setHookFlushProgramOutput(GAUSS::internalHookFlush);
-    setHookProgramInputString(GAUSS::internalHookInputString);
-    setHookProgramInputChar(GAUSS::internalHookInputChar);
-    setHookProgramInputBlockingChar(GAUSS::internalHookInputBlockingChar);
-    setHookProgramInputCheck(GAUSS::internalHookInputCheck);
+    // Registered directly, since the setHook methods mark every thread's hooks as stale
+    GAUSS_HookProgramOutput(GAUSS::internalHookOutput);
+    GAUSS_HookProgramErrorOutput(GAUSS::internalHookError);
+    GAUSS_HookFlushProgramOutput(GAUSS::internalHookFlush);
+    GAUSS_HookProgramInputString(GAUSS::internalHookInputString);
+    GAUSS_HookProgramInputChar(GAUSS::internalHookInputChar);
+    GAUSS_HookProgramInputCharBlocking(GAUSS::internalHookInputBlockingChar);
+    GAUSS_HookProgramInputCheck(GAUSS::internalHookInputCheck);
+
+    kHooksInstalled = GAUSSPrivate::hookGeneration_;
+}
+
+/**
+ * \internal
+ * Register the internal hooks on the calling thread, unless they are already registered. The
+ * engine keeps hooks per thread. The internal hooks look up the user callbacks when they are
+ * called, so changing callbacks does not require registering them again; only the first
+ * execution on a thread, re-initializing the engine or installing other hook functions does.
+ */
+void GAUSS::ensureHooks() {
+    if (kHooksInstalled != GAUSSPrivate::hookGeneration_)
+        resetHooks();
 }
 
 void GAUSS::internalHookOutput(char *output) {
@@ -2962,43 +4901,58 @@ void GAUSS::setHookOutput(void (*display_string_function)(char *str)) {
 
 void GAUSS::setHookProgramErrorOutput(void (*display_error_string_function)(char *)) {
     GAUSS_HookProgramErrorOutput(display_error_string_function);
+    GAUSSPrivate::hookGeneration_++;
 }
 
 void GAUSS::setHookProgramOutput(void (*display_string_function)(char *str)) {
     GAUSS_HookProgramOutput(display_string_function);
+    GAUSSPrivate::hookGeneration_++;
 }
 
 void GAUSS::setHookFlushProgramOutput(void (*flush_display_function)(void)) {
     GAUSS_HookFlushProgramOutput(flush_display_function);
+    GAUSSPrivate::hookGeneration_++;
 }
 
 void GAUSS::setHookProgramInputChar(int (*get_char_function)(void)) {
     GAUSS_HookProgramInputChar(get_char_function);
+    GAUSSPrivate::hookGeneration_++;
 }
 
 void GAUSS::setHookProgramInputBlockingChar(int (*get_char_blocking_function)(void)) {
     GAUSS_HookProgramInputCharBlocking(get_char_blocking_function);
+    GAUSSPrivate::hookGeneration_++;
 }
 
 void GAUSS::setHookProgramInputString(int (*get_string_function)(char *, int)) {
     GAUSS_HookProgramInputString(get_string_function);
+    GAUSSPrivate::hookGeneration_++;
 }
 
 void GAUSS::setHookProgramInputCheck(int (*get_string_function)(void)) {
     GAUSS_HookProgramInputCheck(get_string_function);
+    GAUSSPrivate::hookGeneration_++;
 }
 
 GAUSS::~GAUSS() {
 }
 
 bool GAUSSPrivate::managedOutput_ = true;
+std::atomic<unsigned int> GAUSSPrivate::symbolEpoch_(0);
+std::atomic<unsigned int> GAUSSPrivate::hookGeneration_(1);
 
 GAUSSPrivate::GAUSSPrivate(const std::string &homePath) {
     this->gauss_home_ = homePath;
     this->manager_ = new WorkspaceManager;
+    this->programCache_ = new GEProgramCache;
+    this->workspacePool_ = nullptr;
+    this->workerThreads_ = 0;
 }
 
 GAUSSPrivate::~GAUSSPrivate() {
+    stopAsync();
+    delete this->workspacePool_;
+    delete this->programCache_;
     delete this->manager_;
 }
 
@@ -3013,3 +4967,238 @@ String_t* GAUSSPrivate::createPermString(const std::string &data) {
 
     return newStr;
 }
+
+GESymbol* GAUSSPrivate::fetchSymbol(WorkspaceHandle_t *wh, const std::string &name) const {
+    char *symName = const_cast<char*>(name.c_str());
+
+    switch (GAUSS_GetSymbolType(wh, symName)) {
+    case GESymType::SCALAR:
+    case GESymType::MATRIX: {
+        GAUSS_MatrixInfo_t info;
+
+        if (GAUSS_GetMatrixInfo(wh, &info, symName))
+            return nullptr;
+
+        return new GEMatrix(info);
+    }
+    case GESymType::ARRAY_GAUSS: {
+        Array_t *gsArray = GAUSS_GetArray(wh, symName);
+
+        return gsArray ? new GEArray(gsArray) : nullptr;
+    }
+    case GESymType::STRING:
+    case GESymType::STRING_ARRAY: {
+        StringArray_t *gsStringArray = GAUSS_GetStringArray(wh, symName);
+
+        return gsStringArray ? new GEStringArray(gsStringArray) : nullptr;
+    }
+    default:
+        return nullptr;
+    }
+}
+
+bool GAUSSPrivate::storeSymbol(WorkspaceHandle_t *wh, GESymbol *symbol, const std::string &name) {
+    if (!symbol || name.empty())
+        return false;
+
+    switch (symbol->type()) {
+    case GESymType::SCALAR:
+    case GESymType::MATRIX:
+        return storeMatrix(wh, static_cast<GEMatrix*>(symbol), name);
+    case GESymType::ARRAY_GAUSS:
+        return storeArray(wh, static_cast<GEArray*>(symbol), name);
+    case GESymType::STRING:
+    case GESymType::STRING_ARRAY:
+        return storeStringArray(wh, static_cast<GEStringArray*>(symbol), name);
+    default:
+        return false;
+    }
+}
+
+bool GAUSSPrivate::storeMatrix(WorkspaceHandle_t *wh, GEMatrix *matrix, const std::string &name) {
+    char *symName = const_cast<char*>(name.c_str());
+    int ret = 0;
+
+    if (!matrix->isComplex() && (matrix->getRows() == 1) && (matrix->getCols() == 1)) {
+        ret = GAUSS_PutDouble(wh, matrix->getElement(), symName);
+    } else {
+        std::unique_ptr<Matrix_t> newMat(matrix->toInternal());
+        ret = GAUSS_CopyMatrixToGlobal(wh, newMat.get(), symName);
+    }
+
+    return (ret == GAUSS_SUCCESS);
+}
+
+bool GAUSSPrivate::storeArray(WorkspaceHandle_t *wh, GEArray *array, const std::string &name) {
+    std::unique_ptr<Array_t> newArray(array->toInternal());
+
+    if (!newArray.get())
+        return false;
+
+    return (GAUSS_CopyArrayToGlobal(wh, newArray.get(), const_cast<char*>(name.c_str())) == GAUSS_SUCCESS);
+}
+
+bool GAUSSPrivate::storeStringArray(WorkspaceHandle_t *wh, GEStringArray *sa, const std::string &name) {
+    StringArray_t *newSa = sa->toInternal();
+
+    if (!newSa)
+        return false;
+
+    return (GAUSS_MoveStringArrayToGlobal(wh, newSa, const_cast<char*>(name.c_str())) == GAUSS_SUCCESS);
+}
+
+GESymbol* GAUSSPrivate::moveArgToSymbol(ArgList_t *args, int num) {
+    switch (GAUSS_GetArgType(args, num)) {
+    case GESymType::SCALAR:
+    case GESymType::MATRIX: {
+        Matrix_t *gsMat = GAUSS_MoveArgToMatrix(args, num);
+
+        return gsMat ? new GEMatrix(gsMat) : nullptr;
+    }
+    case GESymType::ARRAY_GAUSS: {
+        Array_t *gsArray = GAUSS_MoveArgToArray(args, num);
+
+        return gsArray ? new GEArray(gsArray) : nullptr;
+    }
+    case GESymType::STRING: {
+        String_t *gsString = GAUSS_MoveArgToString(args, num);
+
+        if (!gsString)
+            return nullptr;
+
+        std::vector<std::string> data(1, gsString->stdata ? std::string(gsString->stdata) : std::string());
+
+        GAUSS_Free(gsString->stdata);
+        GAUSS_Free(gsString);
+
+        return new GEStringArray(data);
+    }
+    case GESymType::STRING_ARRAY: {
+        StringArray_t *gsStringArray = GAUSS_MoveArgToStringArray(args, num);
+
+        return gsStringArray ? new GEStringArray(gsStringArray) : nullptr;
+    }
+    default:
+        return nullptr;
+    }
+}
+
+void GAUSSPrivate::freeSymbol(GESymbol *symbol) {
+    if (!symbol)
+        return;
+
+    switch (symbol->type()) {
+    case GESymType::ARRAY_GAUSS:
+        delete static_cast<GEArray*>(symbol);
+        break;
+    case GESymType::STRING:
+    case GESymType::STRING_ARRAY:
+        delete static_cast<GEStringArray*>(symbol);
+        break;
+    default:
+        delete static_cast<GEMatrix*>(symbol);
+        break;
+    }
+}
+
+ProgramHandle_t* GAUSSPrivate::addProgram(ProgramHandle_t *ph, GEWorkspace *workspace) {
+    if (ph) {
+        std::lock_guard<std::mutex> guard(programMutex_);
+        this->programEpochs_[ph] = workspace->epochRef();
+    }
+
+    return ph;
+}
+
+void GAUSSPrivate::removeProgram(ProgramHandle_t *ph) {
+    std::lock_guard<std::mutex> guard(programMutex_);
+    this->programEpochs_.erase(ph);
+}
+
+/**
+ * Advance the symbol epoch of the workspace _ph_ belongs to. Programs that were not created
+ * through GAUSS advance the epoch shared by all workspaces instead.
+ */
+void GAUSSPrivate::touchProgram(ProgramHandle_t *ph) {
+    std::shared_ptr<std::atomic<unsigned int> > epoch;
+
+    {
+        std::lock_guard<std::mutex> guard(programMutex_);
+        std::unordered_map<ProgramHandle_t*, std::weak_ptr<std::atomic<unsigned int> > >::const_iterator it = this->programEpochs_.find(ph);
+
+        if (it != this->programEpochs_.end())
+            epoch = it->second.lock();
+        else
+            symbolEpoch_++;
+    }
+
+    if (epoch)
+        ++*epoch;
+}
+
+static void freeCompiledProgram(ProgramHandle_t *ph) {
+    GAUSS_FreeProgram(ph);
+}
+
+std::shared_ptr<ProgramHandle_t> GAUSSPrivate::compileString(WorkspaceHandle_t *wh, const std::string &command) {
+    std::string code = command;
+    GEProgramCache *cache = this->programCache_;
+
+    if (cache->enabled()) {
+        std::shared_ptr<ProgramHandle_t> cached = cache->find(wh, GEProgramCache::SOURCE_STRING, code);
+
+        if (cached)
+            return cached;
+
+        ProgramHandle_t *ph = GAUSS_CompileString(wh, removeConst(&code), 0, 0);
+
+        if (!ph)
+            return std::shared_ptr<ProgramHandle_t>();
+
+        return cache->insert(wh, GEProgramCache::SOURCE_STRING, code, ph);
+    }
+
+    ProgramHandle_t *ph = GAUSS_CompileString(wh, removeConst(&code), 0, 0);
+
+    if (!ph)
+        return std::shared_ptr<ProgramHandle_t>();
+
+    return std::shared_ptr<ProgramHandle_t>(ph, freeCompiledProgram);
+}
+
+std::shared_ptr<GEWorkerPool> GAUSSPrivate::workerPool(bool create) {
+    std::lock_guard<std::mutex> guard(workerMutex_);
+
+    if (!this->workerPool_ && create) {
+        int threads = this->workerThreads_;
+
+        if (threads <= 0)
+            threads = std::thread::hardware_concurrency();
+
+        this->workerPool_ = std::make_shared<GEWorkerPool>(threads);
+    }
+
+    return this->workerPool_;
+}
+
+void GAUSSPrivate::postAsync(WorkspaceHandle_t *wh, const std::function<void()> &job) {
+    workerPool(true)->post(wh, [job]() {
+        job();
+
+        // Managed output of worker threads is never read, so do not let it accumulate
+        kOutputStore.clear();
+        kErrorStore.clear();
+    });
+}
+
+void GAUSSPrivate::stopAsync() {
+    std::shared_ptr<GEWorkerPool> pool;
+
+    {
+        std::lock_guard<std::mutex> guard(workerMutex_);
+        pool.swap(this->workerPool_);
+    }
+
+    // Destroying the pool finishes queued jobs and joins the threads
+    pool.reset();
+}
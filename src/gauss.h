@@ -22,13 +22,28 @@
 #include <utility>
 #include <mteng.h>
 #include <string>
+#include <vector>
+#include <map>
+#ifndef SWIG
+#include <future>
+#include <functional>
+#endif
 
 class doubleArray;
 class GESymbol;
 class GEArray;
 class GEMatrix;
+class GEMatrixView;
 class GEStringArray;
 class GEWorkspace;
+class GEProgramCache;
+class GEProcCall;
+class GECancellationToken;
+class GEMappedFile;
+class GEProfile;
+class GEBatchResult;
+class GEWorkspacePool;
+class GEWorkspaceSnapshot;
 class WorkspaceManager;
 class IGEProgramOutput;
 class IGEProgramFlushOutput;
@@ -87,14 +102,22 @@ public:
     GEWorkspace* createWorkspace(std::string name);
     bool destroyWorkspace(GEWorkspace *workspace);
     void destroyAllWorkspaces();
+    GEWorkspace* cloneWorkspace(GEWorkspace *templ, std::string name, const std::vector<std::string> &symbols);
+    std::vector<GEWorkspace*> cloneWorkspaces(GEWorkspace *templ, const std::vector<std::string> &names, const std::vector<std::string> &symbols);
     GEWorkspace* getWorkspace(std::string name) const;
     GEWorkspace* getActiveWorkspace() const;
     bool setActiveWorkspace(GEWorkspace *workspace);
+    void setThreadLocalWorkspaces(bool enabled);
+    bool threadLocalWorkspaces() const;
+    void clearThreadActiveWorkspace();
     GEWorkspace* loadWorkspace(std::string filename);
     std::string getWorkspaceName(GEWorkspace *workspace) const;
     void updateWorkspaceName(GEWorkspace *workspace);
 
     bool saveWorkspace(GEWorkspace *workspace, std::string filename);
+    GEWorkspaceSnapshot* snapshotWorkspace(GEWorkspace *workspace);
+    bool restoreWorkspace(GEWorkspaceSnapshot *snapshot);
+    bool restoreWorkspace(GEWorkspace *workspace, GEWorkspaceSnapshot *snapshot);
     bool saveProgram(ProgramHandle_t *programHandle, std::string filename);
     std::string translateDataloopFile(std::string filename);
 
@@ -111,8 +134,46 @@ public:
     ProgramHandle_t* compileFile(std::string filename, GEWorkspace *workspace);
     ProgramHandle_t* loadCompiledFile(std::string filename);
     ProgramHandle_t* loadCompiledFile(std::string filename, GEWorkspace *workspace);
+    ProgramHandle_t* loadCompiledBuffer(const char *buffer, size_t size);
+    ProgramHandle_t* loadCompiledBuffer(const char *buffer, size_t size, GEWorkspace *workspace);
+    ProgramHandle_t* loadCompiledBuffer(GEMappedFile *file);
+    ProgramHandle_t* loadCompiledBuffer(GEMappedFile *file, GEWorkspace *workspace);
+    ProgramHandle_t* loadCompiledBuffer(GEMappedFile *file, size_t offset, size_t size, GEWorkspace *workspace);
+    ProgramHandle_t* compileExpression(std::string expression);
+    ProgramHandle_t* compileExpression(std::string expression, GEWorkspace *workspace);
+    GESymbol* evaluate(ProgramHandle_t *programHandle);
+    double evaluateScalar(ProgramHandle_t *programHandle);
     bool executeProgram(ProgramHandle_t *programHandle);
+    bool executeProgram(ProgramHandle_t *programHandle, int timeout);
+    bool executeProgram(ProgramHandle_t *programHandle, GECancellationToken *token);
+    GEProfile* profileProgram(ProgramHandle_t *programHandle);
+    GEBatchResult* executeBatch(const std::vector<ProgramHandle_t*> &programs, bool stopOnFailure = false);
+    GEBatchResult* executeBatch(const std::vector<std::string> &commands, bool stopOnFailure = false);
+    GEBatchResult* executeBatch(const std::vector<std::string> &commands, GEWorkspace *workspace, bool stopOnFailure = false);
     void freeProgram(ProgramHandle_t *programHandle);
+    GEProgramCache* getProgramCache() const;
+    GEWorkspacePool* getWorkspacePool() const;
+
+    bool callProc(GEProcCall *call);
+    bool callProc(GEProcCall *call, GEWorkspace *workspace);
+    bool callProc(ProgramHandle_t *programHandle, GEProcCall *call);
+
+#ifndef SWIG
+    // asynchronous execution
+    std::future<bool> executeStringAsync(std::string code);
+    std::future<bool> executeStringAsync(std::string code, GEWorkspace *workspace);
+    void executeStringAsync(std::string code, GEWorkspace *workspace, std::function<void(bool)> callback);
+    std::future<bool> executeProgramAsync(ProgramHandle_t *programHandle);
+    std::future<bool> executeProgramAsync(ProgramHandle_t *programHandle, GEWorkspace *workspace);
+    void executeProgramAsync(ProgramHandle_t *programHandle, GEWorkspace *workspace, std::function<void(bool)> callback);
+    std::future<GEMatrix*> getMatrixAsync(std::string name);
+    std::future<GEMatrix*> getMatrixAsync(std::string name, GEWorkspace *workspace);
+    void getMatrixAsync(std::string name, GEWorkspace *workspace, std::function<void(GEMatrix*)> callback);
+#endif
+    void waitForAsync();
+    void waitForAsync(GEWorkspace *workspace);
+    void setAsyncThreadCount(int count);
+    int asyncThreadCount() const;
 
     std::string makePathAbsolute(std::string path);
     std::string programInputString();
@@ -125,6 +186,11 @@ public:
     GEMatrix* getMatrix(std::string name, GEWorkspace *workspace) const;
     GEMatrix* getMatrixAndClear(std::string name) const;
     GEMatrix* getMatrixAndClear(std::string name, GEWorkspace *workspace) const;
+    bool getMatrixData(std::string name, double *dest, size_t dest_len, int layout) const;
+    bool getMatrixData(std::string name, double *dest, size_t dest_len, int layout, GEWorkspace *workspace) const;
+#ifndef SWIG
+    bool getMatrixData(std::string name, int layout, GEWorkspace *workspace, const std::function<double*(const GAUSS_MatrixInfo_t&)> &allocate) const;
+#endif
     GEArray* getArray(std::string name) const;
     GEArray* getArray(std::string name, GEWorkspace *workspace) const;
     GEArray* getArrayAndClear(std::string name) const;
@@ -142,6 +208,10 @@ public:
     bool setSymbol(std::string, std::string name, GEWorkspace *workspace);
     bool setSymbol(GEStringArray*, std::string name);
     bool setSymbol(GEStringArray*, std::string name, GEWorkspace *workspace);
+    bool setSymbol(const double *data, int rows, int cols, bool is_complex, std::string name);
+    bool setSymbol(const double *data, int rows, int cols, bool is_complex, std::string name, GEWorkspace *workspace);
+    bool setSymbol(const double *data, int rows, int cols, bool is_complex, int layout, std::string name);
+    bool setSymbol(const double *data, int rows, int cols, bool is_complex, int layout, std::string name, GEWorkspace *workspace);
     bool setScalar(double, std::string name);
     bool setScalar(double, std::string name, GEWorkspace *workspace);
 
@@ -154,10 +224,15 @@ public:
 
     bool moveMatrix(doubleArray *data, int rows, int cols, bool is_complex, std::string name);
     bool moveMatrix(doubleArray *data, int rows, int cols, bool is_complex, std::string name, GEWorkspace* workspace);
+    bool moveMatrix(const double *data, int rows, int cols, bool is_complex, std::string name);
+    bool moveMatrix(const double *data, int rows, int cols, bool is_complex, std::string name, GEWorkspace* workspace);
 
     doubleArray* getMatrixDirect(std::string name);
     doubleArray* getMatrixDirect(std::string name, GEWorkspace* workspace);
 
+    GEMatrixView* getMatrixView(std::string name) const;
+    GEMatrixView* getMatrixView(std::string name, GEWorkspace *workspace) const;
+
     bool _setSymbol(doubleArray *data, std::string name);
     bool _setSymbol(doubleArray *data, std::string name, GEWorkspace *workspace);
 
@@ -167,6 +242,11 @@ public:
     GESymbol* getSymbol(std::string name) const;
     GESymbol* getSymbol(std::string name, GEWorkspace *workspace) const;
 
+    std::map<std::string, GESymbol*> getSymbols(const std::vector<std::string> &names) const;
+    std::map<std::string, GESymbol*> getSymbols(const std::vector<std::string> &names, GEWorkspace *workspace) const;
+    bool setSymbols(const std::map<std::string, GESymbol*> &symbols);
+    bool setSymbols(const std::map<std::string, GESymbol*> &symbols, GEWorkspace *workspace);
+
     static bool isMissingValue(double);
 
     static void internalHookOutput(char *output);
@@ -197,6 +277,7 @@ public:
 protected:
     // Keep these private, since we have accessors in place for these.
     void resetHooks();
+    void ensureHooks();
     void setHookOutput(void (*display_string_function)(char *str));
     void setHookProgramErrorOutput(void (*display_error_string_function)(char *));
     void setHookProgramOutput(void (*display_string_function)(char *str));
@@ -209,6 +290,7 @@ protected:
 
 private:
     void Init(std::string homePath);
+    bool runProgram(ProgramHandle_t *ph, GEWorkspace *workspace);
 
     GAUSSPrivate *d;
 
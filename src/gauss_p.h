@@ -3,12 +3,22 @@
 
 #include <string>
 #include <cstdlib>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <functional>
+#include <unordered_map>
 #include <mteng.h>
 
 class WorkspaceManager;
+class GEProgramCache;
+class GEWorkspacePool;
+class GEWorkerPool;
+class GESymbol;
 class GEArray;
 class GEMatrix;
 class GEStringArray;
+class GEWorkspace;
 
 class GAUSSPrivate
 {
@@ -18,10 +28,55 @@ public:
 
     std::string gauss_home_;
     WorkspaceManager *manager_;
+    GEProgramCache *programCache_;
+    GEWorkspacePool *workspacePool_;
+
+    // Created on first asynchronous call. Jobs are keyed by workspace handle, so jobs
+    // for one workspace never run concurrently.
+    std::shared_ptr<GEWorkerPool> workerPool_;
+    int workerThreads_;
+    std::mutex workerMutex_;
+
+    std::shared_ptr<GEWorkerPool> workerPool(bool create);
+    void postAsync(WorkspaceHandle_t *wh, const std::function<void()> &job);
+    void stopAsync();
     static bool managedOutput_;
 
+    // Incremented when a program of unknown workspace is run. Used by GEMatrixView, together
+    // with the epoch of its own workspace, to decide when it must re-validate.
+    static std::atomic<unsigned int> symbolEpoch_;
+
+    // Programs handed out by the compile and load functions, mapped to the symbol epoch of the
+    // workspace they belong to, so running them only invalidates views of that workspace.
+    std::unordered_map<ProgramHandle_t*, std::weak_ptr<std::atomic<unsigned int> > > programEpochs_;
+    std::mutex programMutex_;
+
+    ProgramHandle_t* addProgram(ProgramHandle_t *ph, GEWorkspace *workspace);
+    void removeProgram(ProgramHandle_t *ph);
+    void touchProgram(ProgramHandle_t *ph);
+
+    // Incremented whenever the engine hooks registered on each thread may be stale, so
+    // GAUSS::ensureHooks() registers them again. Threads start out with generation 0.
+    static std::atomic<unsigned int> hookGeneration_;
+
     StringArray_t* createPermStringArray(GEStringArray*);
     String_t* createPermString(const std::string &);
+
+    // Symbol table access without workspace validation. Callers validate the workspace
+    // and advance its epoch as needed.
+    GESymbol* fetchSymbol(WorkspaceHandle_t *wh, const std::string &name) const;
+    bool storeSymbol(WorkspaceHandle_t *wh, GESymbol *symbol, const std::string &name);
+    bool storeMatrix(WorkspaceHandle_t *wh, GEMatrix *matrix, const std::string &name);
+    bool storeArray(WorkspaceHandle_t *wh, GEArray *array, const std::string &name);
+    bool storeStringArray(WorkspaceHandle_t *wh, GEStringArray *sa, const std::string &name);
+
+    // Compile a command, or reuse it from the program cache when that is enabled.
+    // Uncached programs are freed when the last reference goes away.
+    std::shared_ptr<ProgramHandle_t> compileString(WorkspaceHandle_t *wh, const std::string &command);
+
+    // Move an engine argument into a new symbol object, and free a symbol through its concrete type.
+    static GESymbol* moveArgToSymbol(ArgList_t *args, int num);
+    static void freeSymbol(GESymbol *symbol);
 };
 
 #endif // GAUSS_P_H
@@ -1,5 +1,6 @@
 #include "gearray.h"
 #include "gematrix.h"
+#include "gekernels.h"
 #include <cstring>
 #include <sstream>
 
@@ -106,22 +107,18 @@ bool GEArray::Init(Array_t *array) {
 
     int realElements = totalElements();
 
-    this->data_.resize(realElements + this->dims_);
-
     for (int i = 0; i < this->dims_; ++i) {
         int order = array->adata[i];
 
-        this->data_[i] = (double)order;
-
         if (i == this->dims_ - 2)
             this->setRows(order);
         else if (i == this->dims_ - 1)
             this->setCols(order);
     }
 
-    memcpy(this->data_.data() + this->dims_, array->adata + this->dims_, realElements * sizeof(double));
+    // adata holds the orders followed by the data, which is our layout as well. Keep it rather than copying.
+    this->data_.adopt(array->adata, realElements + this->dims_);
 
-    GAUSS_Free(array->adata);
     GAUSS_Free(array);
 
     return true;
@@ -193,6 +190,74 @@ std::string GEArray::toString() const {
     return ss.str();
 }
 
+/**
+ * Create a strided view of a hyperslab of the array. For each dimension, the elements from
+ * _begin_ to _end_ (inclusive, 1-based) are selected, taking every _step_'th element. A `0` in
+ * _begin_ or _end_ selects the first or last element of the dimension (in the direction of _step_),
+ * so `0` in both selects the whole dimension, and equal indices select a single element.
+ *
+ * The slice references this array's data without copying. Use GEArraySlice::getData() or
+ * GEArraySlice::toArray() for a packed copy, which is assembled from contiguous runs wherever
+ * the lowest selected dimensions are unit-stride.
+ *
+ * Example:
+ *
+__Python__
+```py
+ge.executeString("a = areshape(seqa(1, 1, 24), 2|3|4)")
+a = ge.getArray("a")
+
+# Second plane, every row, columns 4 to 1 in reverse
+s = a.slice([2, 0, 4], [2, 0, 1], [1, 1, -1])
+print(s.getOrders())
+print(", ".join(str(n) for n in s.getData()))
+```
+ * will result in the output:
+```
+(1, 3, 4)
+16.0, 15.0, 14.0, 13.0, 20.0, 19.0, 18.0, 17.0, 24.0, 23.0, 22.0, 21.0
+```
+ *
+ * @param begin        First index of each dimension, or 0
+ * @param end        Last index of each dimension, or 0
+ * @param step        Step of each dimension. May be negative, and defaults to 1 if empty.
+ * @return        Array slice. The slice is invalid if the arguments do not match the array orders.
+ */
+GEArraySlice GEArray::slice(std::vector<int> begin, std::vector<int> end, std::vector<int> step) const {
+    const int dims = this->dims_;
+
+    if ((int)begin.size() != dims || (int)end.size() != dims || (!step.empty() && (int)step.size() != dims))
+        return GEArraySlice();
+
+    std::vector<int> orders(dims);
+    std::vector<ptrdiff_t> strides(dims);
+    ptrdiff_t offset = 0;
+    ptrdiff_t product = 1;
+
+    for (int i = dims - 1; i >= 0; --i) {
+        const int order = (int)this->data_[i];
+        const int inc = step.empty() ? 1 : step[i];
+
+        if (inc == 0)
+            return GEArraySlice();
+
+        int first = begin[i] ? begin[i] : (inc > 0 ? 1 : order);
+        int last = end[i] ? end[i] : (inc > 0 ? order : 1);
+
+        // check for out of range
+        if (first < 1 || first > order || last < 1 || last > order || (inc > 0 ? last < first : last > first))
+            return GEArraySlice();
+
+        orders[i] = (last - first) / inc + 1;
+        strides[i] = product * inc;
+        offset += (first - 1) * product;
+
+        product *= order;
+    }
+
+    return GEArraySlice(this->data_.data() + dims + offset, isComplex() ? this->num_elements_ : 0, orders, strides);
+}
+
 /**
  * Retrieve a 2-dimensional slice from an array. The indices array will contain N-2 normal indices into the array,
  * positioning to the first element of the plane of interest, and two indices set to 0, indicating the dimensions of
@@ -261,77 +326,40 @@ Plane [2,.,.]
  * @param imag        Whether to return imaginary data instead of real data.
  * @return        2 dimensional array slice.
  */
-
 GEMatrix* GEArray::getPlane(std::vector<int> indices, bool imag) const {
-    bool complex = isComplex();
-    int offset = (imag && complex ? this->num_elements_ : 0);
-
-    int zero_count = 0;
-
-    int odoi[2];
-    int jdoi[2];
-
-    int product = 1;
-    int jumpoff = 0;
-
-    const int HIGH = 0;
-    const int LOW = 1;
-
-    for (int i = dims_ - 1; i >= 0; --i) {
-        int index = indices[i];
-
-        if (index != 0) {
-            // check for out of range
-            if (index < 1 || index > this->data_[i])
-                return nullptr;
+    if ((int)indices.size() != this->dims_)
+        return nullptr;
 
-            jumpoff += (index - 1) * product;
-        } else {
-            zero_count++;
+    std::vector<int> doi;
 
-            if (zero_count == 1) {
-                odoi[LOW] = this->data_[i];
-                jdoi[LOW] = product;
-            } else {
-                odoi[HIGH] = this->data_[i];
-                jdoi[HIGH] = product;
-            }
-        }
-
-        product *= this->data_[i];
+    for (int i = 0; i < this->dims_; ++i) {
+        if (indices[i] == 0)
+            doi.push_back(i);
     }
 
     // 2 dimensions of interest were not specified
-    if (zero_count != 2)
+    if (doi.size() != 2)
         return nullptr;
 
-    int rows = odoi[HIGH];
-    int cols = odoi[LOW];
-
-    const double *base = this->data_.data() + this->dims_;
+    GEArraySlice plane = slice(indices, indices);
 
-    VECTOR_DATA_INIT(plane, double, rows * cols);
+    if (!plane.isValid())
+        return nullptr;
 
-    for (int i = 0; i < rows; ++i) {
-        for (int j = 0; j < cols; ++j) {
-            // If it's not complex but they want imaginary data, returns 0's.
-            if (!complex && imag)
-                VECTOR_VAR(plane) at(i * cols + j) = 0;
-            else {
-                int index = jumpoff + (jdoi[HIGH] * i) + (jdoi[LOW] * j) + offset;
+    const int rows = (int)this->data_[doi[0]];
+    const int cols = (int)this->data_[doi[1]];
 
-                // index out of range
-                if (index > num_elements_) {
-                    VECTOR_VAR_DELETE_CHECK(plane);
-                    return nullptr;
-                }
+    GEMatrix *ret = new GEMatrix();
+    ret->data_.resize(rows * cols);
+    ret->setRows(rows);
+    ret->setCols(cols);
+    ret->setComplex(false);
 
-                VECTOR_VAR(plane) at(i * cols + j) = base[index];
-            }
-        }
-    }
+    // If it's not complex but they want imaginary data, the plane is left as 0's.
+    if (!imag || isComplex())
+        plane.copyTo(ret->data_.data(), ret->data_.size(), imag);
 
-    return new GEMatrix(plane, rows, cols, imag);
+    return ret;
 }
 
 /**
@@ -386,61 +414,21 @@ Plane [2,.,.]
  * @return        Vector of data
  */
 std::vector<double> GEArray::getVector(std::vector<int> indices, bool imag) const {
-    bool complex = isComplex();
-
-    if (indices.empty() || (imag && !complex))
+    if ((int)indices.size() != this->dims_ || (imag && !isComplex()))
         return std::vector<double>();
 
-    int offset = imag ? this->num_elements_ / 2 : 0;
-    int elements = totalElements();
-
     int zero_count = 0;
 
-    int odoi = 0;
-    int jdoi = 0;
-
-    int product = 1;
-    int jumpoff = 0;
-
-    for (int i = dims_ - 1; i >= 0; --i) {
-        int index = indices[i];
-
-        if (index != 0) {
-            // check for out of range
-            if (index < 1 || index > this->data_[i])
-                return std::vector<double>();
-
-            jumpoff += (index - 1) * product;
-        } else {
+    for (int i = 0; i < this->dims_; ++i) {
+        if (indices[i] == 0)
             zero_count++;
-
-            if (zero_count == 1) {
-                odoi = this->data_[i];
-                jdoi = product;
-            }
-        }
-
-        product *= this->data_[i];
     }
 
-    // 1 dimension of interest were not specified
+    // 1 dimension of interest was not specified
     if (zero_count != 1)
         return std::vector<double>();
 
-    const double *base = this->data_.data() + this->dims_;
-    std::vector<double> result(odoi);
-
-    for (int i = 0; i < odoi; ++i) {
-        int index = jumpoff + (jdoi * i) + offset;
-
-        // index out of range
-        if (index > elements)
-            return std::vector<double>();
-
-        result[i] = base[index];
-    }
-
-    return result;
+    return slice(indices, indices).getData(imag);
 }
 
 /**
@@ -702,6 +690,147 @@ std::vector<double> GEArray::getImagData() const {
     return ret;
 }
 
+/**
+ * Retrieve a copy of the array data with real and imaginary parts interleaved, which is the
+ * layout used by `std::complex<double>` and numpy `complex128`. Real arrays are returned with
+ * imaginary parts of `0`.
+ *
+ * Example:
+ *
+__Python__
+```py
+ge.executeString("c = complex(areshape(seqa(1, 1, 4), 2|1|2), areshape(seqa(5, 1, 4), 2|1|2))")
+c = ge.getArray("c")
+print(", ".join(str(n) for n in c.getInterleavedData()))
+```
+ *
+__PHP__
+```php
+$ge->executeString("c = complex(areshape(seqa(1, 1, 4), 2|1|2), areshape(seqa(5, 1, 4), 2|1|2));");
+$c = $ge->getArray("c");
+echo implode(", ", $c->getInterleavedData()) . PHP_EOL;
+```
+ * will result in the output:
+```
+1.0, 5.0, 2.0, 6.0, 3.0, 7.0, 4.0, 8.0
+```
+ *
+ * @return Array data as a one-dimensional std::vector of `2 * size()` elements
+ *
+ * @see setInterleavedData(std::vector<int>, const double*, size_t)
+ */
+std::vector<double> GEArray::getInterleavedData() const {
+    std::vector<double> ret(2 * this->num_elements_);
+
+    if (!getInterleavedData(ret.data(), ret.size()))
+        return std::vector<double>();
+
+    return ret;
+}
+
+/**
+ * Write the array data with real and imaginary parts interleaved into _dest_, which must
+ * hold _len_ >= `2 * size()` elements.
+ *
+ * @param dest        Destination buffer
+ * @param len        Number of elements available in _dest_
+ * @return        True on success, false if _dest_ is too small.
+ */
+bool GEArray::getInterleavedData(double *dest, size_t len) const {
+    if (!dest || len < 2 * this->num_elements_ || this->data_.size() < this->dims_ + totalElements())
+        return false;
+
+    const double *base = this->data_.data() + this->dims_;
+
+    interleaveComplex(base, isComplex() ? base + this->num_elements_ : nullptr, dest, this->num_elements_);
+
+    return true;
+}
+
+/**
+ * Retrieve a copy of the array data as `std::complex<double>` values.
+ *
+ * @return        Vector of `size()` complex values
+ *
+ * @see getInterleavedData()
+ */
+std::vector<std::complex<double> > GEArray::getComplexData() const {
+    std::vector<std::complex<double> > ret(this->num_elements_);
+
+    // std::complex<double> is layout compatible with double[2]
+    if (!getInterleavedData(reinterpret_cast<double*>(ret.data()), 2 * ret.size()))
+        return std::vector<std::complex<double> >();
+
+    return ret;
+}
+
+/**
+ * Replace the array contents with complex values of the given _orders_, with real and imaginary
+ * parts interleaved. The array becomes complex.
+ *
+ * Example:
+ *
+__Python__
+```py
+import array
+a = GEArray()
+a.setInterleavedData([2, 1, 2], array.array('d', [1.0, 5.0, 2.0, 6.0, 3.0, 7.0, 4.0, 8.0]))
+ge.setSymbol(a, "a")
+```
+ *
+ * @param orders        Dimension orders from highest to lowest left-to-right.
+ * @param interleaved_data        Interleaved complex data
+ * @param interleaved_len        Element count of _interleaved_data_, must be twice the product of _orders_
+ * @return        True on success, false otherwise
+ *
+ * @see getInterleavedData()
+ */
+bool GEArray::setInterleavedData(std::vector<int> orders, const double *interleaved_data, size_t interleaved_len) {
+    if (!interleaved_data || orders.empty())
+        return false;
+
+    size_t elements = 1;
+
+    for (size_t i = 0; i < orders.size(); ++i) {
+        if (orders[i] < 1)
+            return false;
+
+        elements *= orders[i];
+    }
+
+    if (interleaved_len != 2 * elements)
+        return false;
+
+    const int dims = orders.size();
+
+    this->data_.resize(dims + 2 * elements);
+
+    for (int i = 0; i < dims; ++i)
+        this->data_[i] = (double)orders[i];
+
+    splitComplex(interleaved_data, this->data_.data() + dims, this->data_.data() + dims + elements, elements);
+
+    this->dims_ = dims;
+    this->num_elements_ = elements;
+    this->setComplex(true);
+
+    if (dims > 1) {
+        this->setRows(orders[dims - 2]);
+        this->setCols(orders[dims - 1]);
+    }
+
+    return true;
+}
+
+/**
+ * Replace the array contents with `std::complex<double>` values of the given _orders_. The array becomes complex.
+ *
+ * @see setInterleavedData(std::vector<int>, const double*, size_t)
+ */
+bool GEArray::setComplexData(std::vector<int> orders, const std::complex<double> *data, size_t len) {
+    return setInterleavedData(orders, reinterpret_cast<const double*>(data), 2 * len);
+}
+
 /**
  * Retrieve the std::vector of array orders. These are ordered from highest to lowest.
  *
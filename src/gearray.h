@@ -2,6 +2,9 @@
 #define GEARRAY_H
 
 #include "gesymbol.h"
+#include "gebuffer.h"
+#include "gearrayslice.h"
+#include <complex>
 
 /**
  * GAUSS Array symbol type. This represents An N-dimensional array of double precision numbers.
@@ -14,6 +17,8 @@ public:
     GEArray(std::vector<int> orders, VECTOR_DATA(double) data, bool complex = false);
     GEArray(const int *orders, int orders_len, const double *data, int data_len, bool complex = false);
 
+    GEArraySlice slice(std::vector<int> begin, std::vector<int> end, std::vector<int> step = std::vector<int>()) const;
+
     GEMatrix* getPlane(std::vector<int> orders, bool imag = false) const;
     std::vector<double> getVector(std::vector<int> orders, bool imag = false) const;
 
@@ -22,6 +27,8 @@ public:
 
     std::vector<double> getData(bool imag = false) const;
     std::vector<double> getImagData() const;
+    std::vector<double> getInterleavedData() const;
+    bool setInterleavedData(std::vector<int> orders, const double *interleaved_data, size_t interleaved_len);
     std::vector<int> getOrders() const;
 
     int getDimensions() const;
@@ -32,6 +39,15 @@ public:
 
     Array_t* toInternal();
 
+#ifndef SWIG
+    double* data() { return this->data_.empty() ? nullptr : this->data_.data() + this->dims_; }             /**< Pointer to real data, followed by imaginary data if complex. */
+    const double* data() const { return this->data_.empty() ? nullptr : this->data_.data() + this->dims_; } /**< Pointer to real data, followed by imaginary data if complex. */
+
+    bool getInterleavedData(double *dest, size_t len) const;
+    std::vector<std::complex<double> > getComplexData() const;
+    bool setComplexData(std::vector<int> orders, const std::complex<double> *data, size_t len);
+#endif
+
 private:
     GEArray(Array_t*);
     bool Init(Array_t *);
@@ -39,7 +55,7 @@ private:
     size_t totalElements() const { return this->num_elements_ * (isComplex() ? 2: 1); }
 
     // Holds array data
-    std::vector<double> data_;
+    GEBuffer data_;
 
     // Orders of array
     int dims_;
@@ -47,6 +63,8 @@ private:
 
     friend class GAUSS;
     friend class GAUSSPrivate;
+    friend class GEArraySlice;
+    friend class GEProcCall;
 };
 
 #endif // GEARRAY_H
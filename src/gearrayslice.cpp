@@ -0,0 +1,265 @@
+#include "gearrayslice.h"
+#include "gearray.h"
+#include <cstring>
+
+/**
+ * Construct an invalid slice.
+ */
+GEArraySlice::GEArraySlice() : base_(nullptr), imag_offset_(0) {
+}
+
+/** \internal */
+GEArraySlice::GEArraySlice(const double *base, size_t imag_offset, const std::vector<int> &orders, const std::vector<ptrdiff_t> &strides)
+    : base_(base), imag_offset_(imag_offset), orders_(orders), strides_(strides) {
+}
+
+/**
+ * Returns whether this slice references array data. GEArray::slice() returns an invalid
+ * slice if the bounds are out of range.
+ */
+bool GEArraySlice::isValid() const {
+    return this->base_ != nullptr;
+}
+
+/**
+ * Return if the source array is complex.
+ */
+bool GEArraySlice::isComplex() const {
+    return this->imag_offset_ > 0;
+}
+
+/**
+ * Returns whether the slice elements are adjacent in memory, in which case data() can be
+ * read as a packed array.
+ */
+bool GEArraySlice::isContiguous() const {
+    if (!isValid())
+        return false;
+
+    ptrdiff_t expected = 1;
+
+    for (int i = getDimensions() - 1; i >= 0; --i) {
+        if (this->orders_[i] != 1 && this->strides_[i] != expected)
+            return false;
+
+        expected *= this->orders_[i];
+    }
+
+    return true;
+}
+
+/**
+ * Return the number of dimensions, which is the same as the source array.
+ */
+int GEArraySlice::getDimensions() const {
+    return this->orders_.size();
+}
+
+/**
+ * Return the slice orders, from highest to lowest dimension.
+ */
+std::vector<int> GEArraySlice::getOrders() const {
+    return this->orders_;
+}
+
+/**
+ * Return the distance in elements between consecutive indices of each dimension, from highest
+ * to lowest dimension. Strides are negative for slices taken with a negative step.
+ */
+std::vector<int> GEArraySlice::getStrides() const {
+    return std::vector<int>(this->strides_.begin(), this->strides_.end());
+}
+
+/**
+ * Returns the total element count. This is the product of getOrders().
+ */
+int GEArraySlice::size() const {
+    if (!isValid())
+        return 0;
+
+    int ret = 1;
+
+    for (size_t i = 0; i < this->orders_.size(); ++i)
+        ret *= this->orders_[i];
+
+    return ret;
+}
+
+/**
+ * Retrieve an element of the slice. Indices are 1-based and relative to the slice.
+ *
+ * @param indices        Indices indicating the element to retrieve
+ * @param imag        Whether to return imaginary data instead of real data.
+ * @return        double precision element, or 0 if out of range.
+ */
+double GEArraySlice::getElement(std::vector<int> indices, bool imag) const {
+    const double *start = data(imag);
+
+    if (!start || (int)indices.size() != getDimensions())
+        return 0.0;
+
+    ptrdiff_t offset = 0;
+
+    for (size_t i = 0; i < indices.size(); ++i) {
+        if (indices[i] < 1 || indices[i] > this->orders_[i])
+            return 0.0;
+
+        offset += (indices[i] - 1) * this->strides_[i];
+    }
+
+    return start[offset];
+}
+
+/**
+ * Returns a packed copy of the real or imaginary slice data, lowest dimension varying fastest.
+ *
+ * Example:
+ *
+__Python__
+```py
+ge.executeString("a = areshape(seqa(1, 1, 24), 2|3|4)")
+a = ge.getArray("a")
+s = a.slice([0, 2, 1], [0, 3, 0], [1, 1, 2])
+print(", ".join(str(n) for n in s.getData()))
+```
+ * will result in the output:
+```
+5.0, 7.0, 9.0, 11.0, 17.0, 19.0, 21.0, 23.0
+```
+ *
+ * @param imag        True for imaginary data, false for real
+ * @return        Vector of data, empty if the slice is invalid.
+ */
+std::vector<double> GEArraySlice::getData(bool imag) const {
+    if (!data(imag))
+        return std::vector<double>();
+
+    std::vector<double> ret(size());
+    copyTo(ret.data(), ret.size(), imag);
+
+    return ret;
+}
+
+/**
+ * Returns a packed copy of the slice as a new array with the same orders. The caller
+ * takes ownership of the returned object.
+ *
+ * @return        New GEArray, or `nullptr` if the slice is invalid.
+ */
+GEArray* GEArraySlice::toArray() const {
+    if (!isValid())
+        return nullptr;
+
+    const int dims = getDimensions();
+    const size_t elements = size();
+    const bool complex = isComplex();
+
+    GEArray *ret = new GEArray();
+    ret->data_.resize(dims + elements * (complex ? 2 : 1));
+
+    for (int i = 0; i < dims; ++i)
+        ret->data_[i] = (double)this->orders_[i];
+
+    double *dest = ret->data_.data() + dims;
+    copyTo(dest, elements, false);
+
+    if (complex)
+        copyTo(dest + elements, elements, true);
+
+    ret->dims_ = dims;
+    ret->num_elements_ = elements;
+    ret->setComplex(complex);
+
+    if (dims > 1) {
+        ret->setRows(this->orders_[dims - 2]);
+        ret->setCols(this->orders_[dims - 1]);
+    }
+
+    return ret;
+}
+
+/**
+ * Returns a pointer to the first real (or imaginary) element of the slice. Use getStrides()
+ * to address the remaining elements.
+ *
+ * @param imag        True for imaginary data, false for real
+ * @return        Data pointer, or nullptr if the slice is invalid or _imag_ is set for real data.
+ */
+const double* GEArraySlice::data(bool imag) const {
+    if (!isValid() || (imag && !isComplex()))
+        return nullptr;
+
+    return this->base_ + (imag ? this->imag_offset_ : 0);
+}
+
+/**
+ * Copy the real or imaginary slice data into _dest_, packed with the lowest dimension varying
+ * fastest. Dimensions that are contiguous in the source are merged, so the copy is done with
+ * one memcpy per run of unit-stride elements.
+ *
+ * @param dest        Destination buffer
+ * @param len        Number of elements available in _dest_, at least size()
+ * @param imag        True for imaginary data, false for real
+ * @return        True on success, false if the slice is invalid or _dest_ is too small.
+ */
+bool GEArraySlice::copyTo(double *dest, size_t len, bool imag) const {
+    const double *src = data(imag);
+
+    if (!src || !dest || len < (size_t)size())
+        return false;
+
+    // Drop single element dimensions and merge dimensions that continue each other in memory
+    std::vector<ptrdiff_t> counts;
+    std::vector<ptrdiff_t> strides;
+
+    for (int i = getDimensions() - 1; i >= 0; --i) {
+        if (this->orders_[i] == 1)
+            continue;
+
+        if (!counts.empty() && this->strides_[i] == strides.back() * counts.back())
+            counts.back() *= this->orders_[i];
+        else {
+            counts.push_back(this->orders_[i]);
+            strides.push_back(this->strides_[i]);
+        }
+    }
+
+    if (counts.empty()) {
+        *dest = *src;
+        return true;
+    }
+
+    // counts/strides now run from lowest to highest dimension
+    const ptrdiff_t run = counts[0];
+    const ptrdiff_t step = strides[0];
+    const size_t outer = counts.size();
+    std::vector<ptrdiff_t> index(outer, 0);
+
+    while (true) {
+        if (step == 1) {
+            memcpy(dest, src, run * sizeof(double));
+        } else {
+            for (ptrdiff_t i = 0; i < run; ++i)
+                dest[i] = src[i * step];
+        }
+
+        dest += run;
+
+        size_t d = 1;
+
+        for (; d < outer; ++d) {
+            src += strides[d];
+
+            if (++index[d] < counts[d])
+                break;
+
+            src -= strides[d] * counts[d];
+            index[d] = 0;
+        }
+
+        if (d == outer)
+            break;
+    }
+
+    return true;
+}
@@ -0,0 +1,52 @@
+#ifndef GEARRAYSLICE_H
+#define GEARRAYSLICE_H
+
+#include "gesymbol.h"
+#include <cstddef>
+
+class GEArray;
+
+/**
+ * Strided view of a hyperslab of a GEArray, created with GEArray::slice(). The view references
+ * the array data directly; use getData() or toArray() for a packed copy.
+ *
+ * A slice keeps every dimension of the source array, so fixed indices produce dimensions with
+ * an order of `1`. It is only valid while the source array exists and has not been modified
+ * with a method that reallocates its data.
+ */
+class GAUSS_EXPORT GEArraySlice
+{
+public:
+    GEArraySlice();
+
+    bool isValid() const;
+    bool isComplex() const;
+    bool isContiguous() const;
+
+    int getDimensions() const;
+    std::vector<int> getOrders() const;
+    std::vector<int> getStrides() const;
+    int size() const;
+
+    double getElement(std::vector<int> indices, bool imag = false) const;
+
+    std::vector<double> getData(bool imag = false) const;
+    GEArray* toArray() const;
+
+#ifndef SWIG
+    const double* data(bool imag = false) const;
+    bool copyTo(double *dest, size_t len, bool imag = false) const;
+#endif
+
+private:
+    GEArraySlice(const double *base, size_t imag_offset, const std::vector<int> &orders, const std::vector<ptrdiff_t> &strides);
+
+    const double *base_;
+    size_t imag_offset_;
+    std::vector<int> orders_;
+    std::vector<ptrdiff_t> strides_;
+
+    friend class GEArray;
+};
+
+#endif // GEARRAYSLICE_H
@@ -0,0 +1,105 @@
+#include "gebatchresult.h"
+
+/**
+ * Construct an empty result.
+ */
+GEBatchResult::GEBatchResult() {
+}
+
+/**
+ * Return the number of items in the batch, including skipped ones.
+ */
+int GEBatchResult::size() const {
+    return this->items_.size();
+}
+
+/**
+ * Return the number of items that were executed.
+ */
+int GEBatchResult::getExecutedCount() const {
+    int count = 0;
+
+    for (size_t i = 0; i < this->items_.size(); ++i) {
+        if (this->items_.at(i).executed)
+            ++count;
+    }
+
+    return count;
+}
+
+/**
+ * Return whether an item was executed, rather than skipped after an earlier failure.
+ *
+ * @param index        0-based item index
+ */
+bool GEBatchResult::wasExecuted(int index) const {
+    return validIndex(index) && this->items_.at(index).executed;
+}
+
+/**
+ * Return whether an item compiled and executed successfully.
+ *
+ * @param index        0-based item index
+ */
+bool GEBatchResult::getSuccess(int index) const {
+    return validIndex(index) && this->items_.at(index).success;
+}
+
+/**
+ * Return the time an item took in seconds, including compilation for string items.
+ *
+ * @param index        0-based item index
+ */
+double GEBatchResult::getTime(int index) const {
+    return validIndex(index) ? this->items_.at(index).time : 0;
+}
+
+/**
+ * Return the sum of the time of all items in seconds.
+ */
+double GEBatchResult::getTotalTime() const {
+    double total = 0;
+
+    for (size_t i = 0; i < this->items_.size(); ++i)
+        total += this->items_.at(i).time;
+
+    return total;
+}
+
+/**
+ * Return whether every item was executed successfully.
+ */
+bool GEBatchResult::allSucceeded() const {
+    return getFirstFailure() < 0;
+}
+
+/**
+ * Return the index of the first item that failed or was skipped, or `-1` if all succeeded.
+ */
+int GEBatchResult::getFirstFailure() const {
+    for (size_t i = 0; i < this->items_.size(); ++i) {
+        if (!this->items_.at(i).success)
+            return i;
+    }
+
+    return -1;
+}
+
+void GEBatchResult::resize(int count) {
+    Item item = { false, false, 0 };
+    this->items_.assign(count, item);
+}
+
+void GEBatchResult::setItem(int index, bool success, double time) {
+    if (!validIndex(index))
+        return;
+
+    Item &item = this->items_.at(index);
+    item.executed = true;
+    item.success = success;
+    item.time = time;
+}
+
+bool GEBatchResult::validIndex(int index) const {
+    return index >= 0 && index < size();
+}
@@ -0,0 +1,41 @@
+#ifndef GEBATCHRESULT_H
+#define GEBATCHRESULT_H
+
+#include "gauss.h"
+#include <vector>
+
+/**
+ * Outcome of GAUSS::executeBatch(): whether each item succeeded and how long it took. Items that
+ * were skipped because the batch stopped at a failure are reported as not executed.
+ */
+class GAUSS_EXPORT GEBatchResult
+{
+public:
+    GEBatchResult();
+
+    int size() const;
+    int getExecutedCount() const;
+    bool wasExecuted(int index) const;
+    bool getSuccess(int index) const;
+    double getTime(int index) const;
+    double getTotalTime() const;
+    bool allSucceeded() const;
+    int getFirstFailure() const;
+
+private:
+    struct Item {
+        bool executed;
+        bool success;
+        double time;
+    };
+
+    void resize(int count);
+    void setItem(int index, bool success, double time);
+    bool validIndex(int index) const;
+
+    std::vector<Item> items_;
+
+    friend class GAUSS;
+};
+
+#endif // GEBATCHRESULT_H
@@ -0,0 +1,148 @@
+#include "gebuffer.h"
+#include <cstring>
+#include <stdexcept>
+#include <new>
+#include <algorithm>
+
+GEBuffer::GEBuffer() : data_(nullptr), size_(0) {
+}
+
+/**
+ * Allocate _size_ elements, initialized to zero.
+ */
+GEBuffer::GEBuffer(size_t size) : data_(nullptr), size_(0) {
+    resize(size);
+}
+
+GEBuffer::GEBuffer(const GEBuffer &other) : data_(nullptr), size_(0) {
+    *this = other;
+}
+
+GEBuffer::GEBuffer(GEBuffer &&other) : data_(other.data_), size_(other.size_) {
+    other.data_ = nullptr;
+    other.size_ = 0;
+}
+
+GEBuffer::~GEBuffer() {
+    clear();
+}
+
+GEBuffer& GEBuffer::operator=(const GEBuffer &other) {
+    if (this == &other)
+        return *this;
+
+    clear();
+
+    if (other.empty())
+        return *this;
+
+    this->data_ = static_cast<double*>(GAUSS_Malloc(other.size_ * sizeof(double)));
+
+    if (!this->data_)
+        throw std::bad_alloc();
+
+    this->size_ = other.size_;
+    memcpy(this->data_, other.data_, this->size_ * sizeof(double));
+
+    return *this;
+}
+
+GEBuffer& GEBuffer::operator=(GEBuffer &&other) {
+    if (this == &other)
+        return *this;
+
+    clear();
+
+    this->data_ = other.data_;
+    this->size_ = other.size_;
+    other.data_ = nullptr;
+    other.size_ = 0;
+
+    return *this;
+}
+
+/**
+ * Resize to _size_ elements. Existing values are kept, and new elements are set to zero.
+ */
+void GEBuffer::resize(size_t size) {
+    if (size == this->size_)
+        return;
+
+    if (!size) {
+        clear();
+        return;
+    }
+
+    double *newData = static_cast<double*>(GAUSS_Malloc(size * sizeof(double)));
+
+    if (!newData)
+        throw std::bad_alloc();
+
+    size_t keep = std::min(size, this->size_);
+
+    if (keep)
+        memcpy(newData, this->data_, keep * sizeof(double));
+
+    if (size > keep)
+        memset(newData + keep, 0, (size - keep) * sizeof(double));
+
+    if (this->data_)
+        GAUSS_Free(this->data_);
+
+    this->data_ = newData;
+    this->size_ = size;
+}
+
+/**
+ * Free all elements.
+ */
+void GEBuffer::clear() {
+    if (this->data_)
+        GAUSS_Free(this->data_);
+
+    this->data_ = nullptr;
+    this->size_ = 0;
+}
+
+double& GEBuffer::at(size_t i) {
+    if (i >= this->size_)
+        throw std::out_of_range("GEBuffer::at");
+
+    return this->data_[i];
+}
+
+const double& GEBuffer::at(size_t i) const {
+    if (i >= this->size_)
+        throw std::out_of_range("GEBuffer::at");
+
+    return this->data_[i];
+}
+
+/**
+ * Give up ownership of the allocation. The caller becomes responsible for releasing it with GAUSS_Free,
+ * or for passing it to the engine as freeable memory. The buffer is left empty.
+ */
+double* GEBuffer::release() {
+    double *ret = this->data_;
+
+    this->data_ = nullptr;
+    this->size_ = 0;
+
+    return ret;
+}
+
+/**
+ * Take ownership of _data_, which must have been allocated with GAUSS_Malloc and hold
+ * at least _size_ elements. Any existing allocation is freed.
+ */
+void GEBuffer::adopt(double *data, size_t size) {
+    if (data == this->data_) {
+        this->size_ = size;
+        return;
+    }
+
+    clear();
+
+    this->data_ = data;
+    this->size_ = data ? size : 0;
+}
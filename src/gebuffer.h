@@ -0,0 +1,55 @@
+#ifndef GEBUFFER_H
+#define GEBUFFER_H
+
+#include "gauss.h"
+#include <cstddef>
+
+/**
+ * Contiguous storage of double precision values allocated with GAUSS_Malloc. Used as the
+ * backing store for GEMatrix and GEArray so that their memory can be handed to the symbol
+ * table without a copy.
+ *
+ * The interface follows the subset of std::vector<double> those classes use. Copies are deep.
+ */
+class GAUSS_EXPORT GEBuffer
+{
+public:
+    typedef double* iterator;
+    typedef const double* const_iterator;
+
+    GEBuffer();
+    explicit GEBuffer(size_t size);
+    GEBuffer(const GEBuffer &other);
+    GEBuffer(GEBuffer &&other);
+    ~GEBuffer();
+
+    GEBuffer& operator=(const GEBuffer &other);
+    GEBuffer& operator=(GEBuffer &&other);
+
+    void resize(size_t size);
+    void clear();
+
+    double* data() { return data_; }
+    const double* data() const { return data_; }
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    double& operator[](size_t i) { return data_[i]; }
+    const double& operator[](size_t i) const { return data_[i]; }
+    double& at(size_t i);
+    const double& at(size_t i) const;
+
+    iterator begin() { return data_; }
+    iterator end() { return data_ + size_; }
+    const_iterator begin() const { return data_; }
+    const_iterator end() const { return data_ + size_; }
+
+    double* release();
+    void adopt(double *data, size_t size);
+
+private:
+    double *data_;
+    size_t size_;
+};
+
+#endif // GEBUFFER_H
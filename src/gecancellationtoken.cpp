@@ -0,0 +1,246 @@
+#include "gecancellationtoken.h"
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <thread>
+
+namespace {
+
+/**
+ * Single background thread that cancels tokens whose deadline has passed. Tokens are cancelled
+ * while the timer lock is held, so remove() returning guarantees the token is no longer touched.
+ */
+class DeadlineTimer
+{
+public:
+    typedef std::chrono::steady_clock Clock;
+
+    DeadlineTimer() : next_id_(1), stop_(false) {
+    }
+
+    ~DeadlineTimer() {
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            this->stop_ = true;
+        }
+
+        this->cv_.notify_all();
+
+        if (this->thread_.joinable())
+            this->thread_.join();
+    }
+
+    unsigned long long schedule(Clock::time_point deadline, GECancellationToken *token) {
+        std::lock_guard<std::mutex> guard(mutex_);
+
+        if (!this->thread_.joinable())
+            this->thread_ = std::thread(&DeadlineTimer::run, this);
+
+        unsigned long long id = this->next_id_++;
+        Entry entry = { id, token };
+        this->entries_.insert(std::make_pair(deadline, entry));
+
+        this->cv_.notify_all();
+
+        return id;
+    }
+
+    void remove(unsigned long long id) {
+        if (!id)
+            return;
+
+        std::lock_guard<std::mutex> guard(mutex_);
+
+        for (EntryMap::iterator it = this->entries_.begin(); it != this->entries_.end(); ++it) {
+            if (it->second.id == id) {
+                this->entries_.erase(it);
+                return;
+            }
+        }
+    }
+
+private:
+    struct Entry {
+        unsigned long long id;
+        GECancellationToken *token;
+    };
+
+    typedef std::multimap<Clock::time_point, Entry> EntryMap;
+
+    void run() {
+        std::unique_lock<std::mutex> lock(mutex_);
+
+        while (!this->stop_) {
+            if (this->entries_.empty()) {
+                this->cv_.wait(lock);
+                continue;
+            }
+
+            EntryMap::iterator first = this->entries_.begin();
+
+            if (Clock::now() < first->first) {
+                this->cv_.wait_until(lock, first->first);
+                continue;
+            }
+
+            GECancellationToken *token = first->second.token;
+            this->entries_.erase(first);
+            token->cancel();
+        }
+    }
+
+    EntryMap entries_;
+    unsigned long long next_id_;
+    bool stop_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::thread thread_;
+};
+
+DeadlineTimer& deadlineTimer() {
+    static DeadlineTimer timer;
+    return timer;
+}
+
+}
+
+/**
+ * Construct a token that is not cancelled.
+ *
+ * Example:
+ *
+__Python__
+```py
+ph = ge.compileString("x = 0; do while 1; x = x + 1; endo;")
+
+token = GECancellationToken()
+token.cancelAfter(500)
+
+if not ge.executeProgram(ph, token) and token.isCancelled():
+    print("Deadline exceeded")
+```
+ * will result in the output:
+```
+Deadline exceeded
+```
+ */
+GECancellationToken::GECancellationToken()
+    : cancelled_(false), running_(false), interrupted_(false), thread_(), deadline_id_(0) {
+}
+
+GECancellationToken::~GECancellationToken() {
+    clearDeadline();
+}
+
+/**
+ * Cancel the token. If a program is executing with this token, it is interrupted. This can be
+ * called from any thread.
+ */
+void GECancellationToken::cancel() {
+    std::lock_guard<std::mutex> guard(mutex_);
+
+    if (this->cancelled_)
+        return;
+
+    this->cancelled_ = true;
+
+    if (this->running_ && !this->interrupted_) {
+        GAUSS_SetInterrupt(this->thread_);
+        this->interrupted_ = true;
+    }
+}
+
+/**
+ * Cancel the token once _milliseconds_ have passed, replacing any earlier deadline. The
+ * deadline is enforced by a shared timer thread, so it also applies while the calling thread is
+ * blocked in the engine.
+ *
+ * @param milliseconds        Time until the token is cancelled
+ */
+void GECancellationToken::cancelAfter(int milliseconds) {
+    clearDeadline();
+
+    if (milliseconds < 0)
+        milliseconds = 0;
+
+    unsigned long long id = deadlineTimer().schedule(
+        DeadlineTimer::Clock::now() + std::chrono::milliseconds(milliseconds), this);
+
+    std::lock_guard<std::mutex> guard(mutex_);
+    this->deadline_id_ = id;
+}
+
+/**
+ * Return whether the token has been cancelled, either by cancel() or because its deadline passed.
+ */
+bool GECancellationToken::isCancelled() const {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return this->cancelled_;
+}
+
+/**
+ * Clear the cancelled state and any pending deadline, so the token can be reused. This fails
+ * while a program is executing with the token.
+ *
+ * @return        True on success, false if the token is in use
+ */
+bool GECancellationToken::reset() {
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+
+        if (this->running_)
+            return false;
+    }
+
+    clearDeadline();
+
+    std::lock_guard<std::mutex> guard(mutex_);
+    this->cancelled_ = false;
+
+    return true;
+}
+
+/**
+ * \internal
+ * Record the calling thread as the one executing with this token. Returns false if the token is
+ * already cancelled or in use.
+ */
+bool GECancellationToken::attach() {
+    std::lock_guard<std::mutex> guard(mutex_);
+
+    if (this->cancelled_ || this->running_)
+        return false;
+
+    this->thread_ = pthread_self();
+    this->running_ = true;
+    this->interrupted_ = false;
+
+    return true;
+}
+
+/**
+ * \internal
+ * Forget the executing thread, clearing the interrupt if one was raised for it.
+ */
+void GECancellationToken::detach() {
+    std::lock_guard<std::mutex> guard(mutex_);
+
+    if (this->interrupted_)
+        GAUSS_ClearInterrupt(this->thread_);
+
+    this->running_ = false;
+    this->interrupted_ = false;
+}
+
+void GECancellationToken::clearDeadline() {
+    unsigned long long id = 0;
+
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        id = this->deadline_id_;
+        this->deadline_id_ = 0;
+    }
+
+    // Must not hold our own lock here: the timer cancels tokens while holding its lock
+    deadlineTimer().remove(id);
+}
@@ -0,0 +1,46 @@
+#ifndef GECANCELLATIONTOKEN_H
+#define GECANCELLATIONTOKEN_H
+
+#include "gauss.h"
+#include <mutex>
+
+/**
+ * Cancels a running program from another thread, or after a deadline. Pass it to
+ * GAUSS::executeProgram(ProgramHandle_t*, GECancellationToken*); while the program runs, the
+ * token records the executing thread so that cancel() can interrupt it with GAUSS_SetInterrupt().
+ * The interrupt is cleared again when the program returns.
+ *
+ * A cancelled token stays cancelled, and programs executed with it fail immediately, until
+ * reset() is called.
+ */
+class GAUSS_EXPORT GECancellationToken
+{
+public:
+    GECancellationToken();
+    ~GECancellationToken();
+
+    void cancel();
+    void cancelAfter(int milliseconds);
+    bool isCancelled() const;
+    bool reset();
+
+#ifndef SWIG
+    bool attach();
+    void detach();
+#endif
+
+private:
+    GECancellationToken(const GECancellationToken&);
+    GECancellationToken& operator=(const GECancellationToken&);
+
+    void clearDeadline();
+
+    mutable std::mutex mutex_;
+    bool cancelled_;
+    bool running_;
+    bool interrupted_;
+    pthread_t thread_;
+    unsigned long long deadline_id_;
+};
+
+#endif // GECANCELLATIONTOKEN_H
@@ -0,0 +1,199 @@
+#include "gekernels.h"
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define GE_HAVE_SSE2
+#include <emmintrin.h>
+#endif
+
+// AVX is used when the build enables it, or through runtime dispatch with GCC/Clang on x86.
+#if defined(__AVX__)
+#define GE_HAVE_AVX
+#define GE_AVX_TARGET
+#include <immintrin.h>
+#elif defined(GE_HAVE_SSE2) && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define GE_HAVE_AVX
+#define GE_AVX_DISPATCH
+#define GE_AVX_TARGET __attribute__((target("avx")))
+#include <immintrin.h>
+#endif
+
+static void interleaveScalar(const double *real, const double *imag, double *dest, size_t i, size_t n) {
+    for (; i < n; ++i) {
+        dest[2 * i] = real[i];
+        dest[2 * i + 1] = imag ? imag[i] : 0.0;
+    }
+}
+
+static void splitScalar(const double *src, double *real, double *imag, size_t i, size_t n) {
+    for (; i < n; ++i) {
+        real[i] = src[2 * i];
+        imag[i] = src[2 * i + 1];
+    }
+}
+
+#ifdef GE_HAVE_SSE2
+static void interleaveSSE2(const double *real, const double *imag, double *dest, size_t n) {
+    size_t i = 0;
+    const __m128d zero = _mm_setzero_pd();
+
+    for (; i + 2 <= n; i += 2) {
+        __m128d r = _mm_loadu_pd(real + i);
+        __m128d m = imag ? _mm_loadu_pd(imag + i) : zero;
+        _mm_storeu_pd(dest + 2 * i, _mm_unpacklo_pd(r, m));
+        _mm_storeu_pd(dest + 2 * i + 2, _mm_unpackhi_pd(r, m));
+    }
+
+    interleaveScalar(real, imag, dest, i, n);
+}
+
+static void splitSSE2(const double *src, double *real, double *imag, size_t n) {
+    size_t i = 0;
+
+    for (; i + 2 <= n; i += 2) {
+        __m128d a = _mm_loadu_pd(src + 2 * i);      // r0 i0
+        __m128d b = _mm_loadu_pd(src + 2 * i + 2);  // r1 i1
+        _mm_storeu_pd(real + i, _mm_unpacklo_pd(a, b));
+        _mm_storeu_pd(imag + i, _mm_unpackhi_pd(a, b));
+    }
+
+    splitScalar(src, real, imag, i, n);
+}
+#endif
+
+#ifdef GE_HAVE_AVX
+GE_AVX_TARGET static void interleaveAVX(const double *real, const double *imag, double *dest, size_t n) {
+    size_t i = 0;
+    const __m256d zero = _mm256_setzero_pd();
+
+    for (; i + 4 <= n; i += 4) {
+        __m256d r = _mm256_loadu_pd(real + i);
+        __m256d m = imag ? _mm256_loadu_pd(imag + i) : zero;
+        __m256d lo = _mm256_unpacklo_pd(r, m);     // r0 i0 r2 i2
+        __m256d hi = _mm256_unpackhi_pd(r, m);     // r1 i1 r3 i3
+        _mm256_storeu_pd(dest + 2 * i, _mm256_permute2f128_pd(lo, hi, 0x20));
+        _mm256_storeu_pd(dest + 2 * i + 4, _mm256_permute2f128_pd(lo, hi, 0x31));
+    }
+
+    interleaveScalar(real, imag, dest, i, n);
+}
+
+GE_AVX_TARGET static void splitAVX(const double *src, double *real, double *imag, size_t n) {
+    size_t i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        __m256d a = _mm256_loadu_pd(src + 2 * i);      // r0 i0 r1 i1
+        __m256d b = _mm256_loadu_pd(src + 2 * i + 4);  // r2 i2 r3 i3
+        __m256d t0 = _mm256_permute2f128_pd(a, b, 0x20); // r0 i0 r2 i2
+        __m256d t1 = _mm256_permute2f128_pd(a, b, 0x31); // r1 i1 r3 i3
+        _mm256_storeu_pd(real + i, _mm256_unpacklo_pd(t0, t1));
+        _mm256_storeu_pd(imag + i, _mm256_unpackhi_pd(t0, t1));
+    }
+
+    splitScalar(src, real, imag, i, n);
+}
+
+static bool haveAVX() {
+#ifdef GE_AVX_DISPATCH
+    static const bool supported = __builtin_cpu_supports("avx");
+    return supported;
+#else
+    return true;
+#endif
+}
+#endif
+
+void interleaveComplex(const double *real, const double *imag, double *dest, size_t n) {
+#if defined(GE_HAVE_AVX)
+    if (haveAVX()) {
+        interleaveAVX(real, imag, dest, n);
+        return;
+    }
+#endif
+#if defined(GE_HAVE_SSE2)
+    interleaveSSE2(real, imag, dest, n);
+#else
+    interleaveScalar(real, imag, dest, 0, n);
+#endif
+}
+
+void splitComplex(const double *src, double *real, double *imag, size_t n) {
+#if defined(GE_HAVE_AVX)
+    if (haveAVX()) {
+        splitAVX(src, real, imag, n);
+        return;
+    }
+#endif
+#if defined(GE_HAVE_SSE2)
+    splitSSE2(src, real, imag, n);
+#else
+    splitScalar(src, real, imag, 0, n);
+#endif
+}
+
+// Edge length of the square tiles used for transposing. 32x32 doubles of source and
+// destination together fit comfortably in L1.
+static const size_t kTransposeBlock = 32;
+
+// Minimum number of elements each transpose thread should handle before spawning is worthwhile.
+static const size_t kTransposeElementsPerThread = 1 << 20;
+
+static const unsigned kTransposeMaxThreads = 16;
+
+static void transposeRows(const double *src, double *dest, size_t rows, size_t cols, size_t rowBegin, size_t rowEnd) {
+    for (size_t i0 = rowBegin; i0 < rowEnd; i0 += kTransposeBlock) {
+        const size_t iMax = std::min(i0 + kTransposeBlock, rowEnd);
+
+        for (size_t j0 = 0; j0 < cols; j0 += kTransposeBlock) {
+            const size_t jMax = std::min(j0 + kTransposeBlock, cols);
+
+            for (size_t i = i0; i < iMax; ++i) {
+                const double *s = src + i * cols;
+
+                for (size_t j = j0; j < jMax; ++j)
+                    dest[j * rows + i] = s[j];
+            }
+        }
+    }
+}
+
+void transposeMatrix(const double *src, double *dest, size_t rows, size_t cols) {
+    const size_t elements = rows * cols;
+
+    if (!elements)
+        return;
+
+    if (rows == 1 || cols == 1) {
+        std::copy(src, src + elements, dest);
+        return;
+    }
+
+    size_t threads = std::min<size_t>(std::max(1u, std::thread::hardware_concurrency()), kTransposeMaxThreads);
+    threads = std::min(threads, elements / kTransposeElementsPerThread);
+    threads = std::min(threads, (rows + kTransposeBlock - 1) / kTransposeBlock);
+
+    if (threads <= 1) {
+        transposeRows(src, dest, rows, cols, 0, rows);
+        return;
+    }
+
+    // Give each thread a band of whole tiles
+    size_t blocks = (rows + kTransposeBlock - 1) / kTransposeBlock;
+    size_t blocksPerThread = (blocks + threads - 1) / threads;
+    size_t rowsPerThread = blocksPerThread * kTransposeBlock;
+
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+
+    size_t begin = 0;
+
+    for (size_t t = 0; t < threads - 1 && begin + rowsPerThread < rows; ++t, begin += rowsPerThread)
+        workers.push_back(std::thread(transposeRows, src, dest, rows, cols, begin, begin + rowsPerThread));
+
+    transposeRows(src, dest, rows, cols, begin, rows);
+
+    for (size_t t = 0; t < workers.size(); ++t)
+        workers[t].join();
+}
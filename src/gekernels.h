@@ -0,0 +1,23 @@
+#ifndef GEKERNELS_H
+#define GEKERNELS_H
+
+#include <cstddef>
+
+/*
+ * Conversion kernels shared by the symbol classes. These are internal and not exported.
+ *
+ * GAUSS stores complex data split, all real values followed by all imaginary values.
+ * Most external consumers (std::complex, numpy complex128, FFTW) expect them interleaved.
+ */
+
+// dest[2*i] = real[i], dest[2*i+1] = imag[i]. A null imag interleaves zeros.
+void interleaveComplex(const double *real, const double *imag, double *dest, size_t n);
+
+// real[i] = src[2*i], imag[i] = src[2*i+1]
+void splitComplex(const double *src, double *real, double *imag, size_t n);
+
+// Transpose a row-major rows x cols matrix into dest (cols x rows). Cache-blocked, and split
+// across threads for large matrices. src and dest must not overlap.
+void transposeMatrix(const double *src, double *dest, size_t rows, size_t cols);
+
+#endif // GEKERNELS_H
@@ -0,0 +1,30 @@
+#ifndef GELAYOUT_H
+#define GELAYOUT_H
+
+/**
+ * GELayout stores the memory layouts accepted by the layout-aware transfer functions.
+ * GAUSS itself always stores matrices in row-major order; data in column-major order
+ * (Fortran, LAPACK, Eigen defaults) is transposed as part of the copy.
+ * Access these in a static fashion.
+ *
+ * Example:
+ *
+__Python__
+```py
+import numpy as np
+x = np.asfortranarray(np.arange(6.0).reshape(2, 3))
+ge.setSymbol(x, "x")
+y = np.asarray(ge.getMatrixData("x", GELayout.COL_MAJOR))
+```
+ *
+ * @see GAUSS::getMatrixData(std::string, double*, size_t, int)
+ * @see GAUSS::setSymbol(const double*, int, int, bool, int, std::string)
+ */
+typedef struct GELayout_s
+{
+public:
+    static const int ROW_MAJOR = 0;      /**< C order, rows are contiguous */
+    static const int COL_MAJOR = 1;      /**< Fortran order, columns are contiguous */
+} GELayout;
+
+#endif // GELAYOUT_H
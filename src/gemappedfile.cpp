@@ -0,0 +1,114 @@
+#include "gemappedfile.h"
+
+#ifdef _WIN32
+#include "windows.h"
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+/**
+ * Map _filename_ into memory. Use isValid() to check whether the file could be mapped.
+ *
+ * Example:
+ *
+__Python__
+```py
+bundle = GEMappedFile("programs.gcg")
+
+for i in range(0, 8):
+    wh = ge.createWorkspace("worker" + str(i))
+    ph = ge.loadCompiledBuffer(bundle, wh)
+    ge.executeProgram(ph)
+```
+ *
+ * @param filename        File to map
+ */
+GEMappedFile::GEMappedFile(std::string filename) : filename_(filename), data_(nullptr), size_(0) {
+#ifdef _WIN32
+    HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+
+    if (file == INVALID_HANDLE_VALUE)
+        return;
+
+    LARGE_INTEGER fileSize;
+
+    if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0) {
+        HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+
+        if (mapping) {
+            this->data_ = static_cast<char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+
+            if (this->data_)
+                this->size_ = fileSize.QuadPart;
+
+            // The view keeps the mapping alive
+            CloseHandle(mapping);
+        }
+    }
+
+    CloseHandle(file);
+#else
+    int fd = open(filename.c_str(), O_RDONLY);
+
+    if (fd < 0)
+        return;
+
+    struct stat info;
+
+    if (fstat(fd, &info) == 0 && info.st_size > 0) {
+        // Read-only; loadCompiledBuffer() copies each program before the engine sees it
+        void *addr = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+        if (addr != MAP_FAILED) {
+            this->data_ = static_cast<char*>(addr);
+            this->size_ = info.st_size;
+        }
+    }
+
+    // The mapping stays valid after the descriptor is closed
+    close(fd);
+#endif
+}
+
+GEMappedFile::~GEMappedFile() {
+    if (!this->data_)
+        return;
+
+#ifdef _WIN32
+    UnmapViewOfFile(this->data_);
+#else
+    munmap(this->data_, this->size_);
+#endif
+}
+
+/**
+ * Return whether the file was mapped successfully.
+ */
+bool GEMappedFile::isValid() const {
+    return this->data_ != nullptr;
+}
+
+/**
+ * Return the name of the mapped file.
+ */
+std::string GEMappedFile::filename() const {
+    return this->filename_;
+}
+
+/**
+ * Return the size of the mapping in bytes, or `0` if the file could not be mapped.
+ */
+size_t GEMappedFile::size() const {
+    return this->size_;
+}
+
+/**
+ * \internal
+ * Return the start of the mapping.
+ */
+const char* GEMappedFile::data() const {
+    return this->data_;
+}
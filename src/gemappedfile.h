@@ -0,0 +1,42 @@
+#ifndef GEMAPPEDFILE_H
+#define GEMAPPEDFILE_H
+
+#include "gauss.h"
+#include <string>
+
+/**
+ * Read-only memory mapping of a file, used to load compiled programs with
+ * GAUSS::loadCompiledBuffer(GEMappedFile*, GEWorkspace*) without opening and reading the file
+ * for every workspace. The file is mapped read-only and each program is copied out of the mapping
+ * when it is loaded, so the file on disk is never modified.
+ *
+ * A single mapping can hold several compiled programs back to back; load each one with
+ * GAUSS::loadCompiledBuffer(GEMappedFile*, size_t, size_t, GEWorkspace*).
+ *
+ * Programs loaded from the mapping do not refer to it, so it can be destroyed as soon as the
+ * programs it holds have been loaded.
+ */
+class GAUSS_EXPORT GEMappedFile
+{
+public:
+    GEMappedFile(std::string filename);
+    ~GEMappedFile();
+
+    bool isValid() const;
+    std::string filename() const;
+    size_t size() const;
+
+#ifndef SWIG
+    const char* data() const;
+#endif
+
+private:
+    GEMappedFile(const GEMappedFile&);
+    GEMappedFile& operator=(const GEMappedFile&);
+
+    std::string filename_;
+    char *data_;
+    size_t size_;
+};
+
+#endif // GEMAPPEDFILE_H
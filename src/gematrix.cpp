@@ -1,4 +1,5 @@
 #include "gematrix.h"
+#include "gekernels.h"
 #include <cstring>
 #include <cmath>
 #include <sstream>
@@ -58,7 +59,8 @@ $ge->executeString("print x;");
  * @param d Scalar value
  */
 GEMatrix::GEMatrix(double n) : GESymbol(GESymType::MATRIX) {
-    this->data_.push_back(n);
+    this->data_.resize(1);
+    this->data_[0] = n;
     this->setRows(1);
     this->setCols(1);
     this->setComplex(false);
@@ -77,10 +79,9 @@ GEMatrix::GEMatrix(Matrix_t* mat) : GESymbol(GESymType::MATRIX) {
 
     int elements = size() * (isComplex() ? 2 : 1);
 
-    this->data_.resize(elements);
-    memcpy(this->data_.data(), mat->mdata, elements * sizeof(double));
+    // We have ownership of original from symbol table, keep it rather than copying
+    this->data_.adopt(mat->mdata, elements);
 
-    GAUSS_Free(mat->mdata); // We have ownership of original from symbol table
     GAUSS_Free(mat);
 }
 
@@ -466,7 +467,7 @@ std::vector<double> GEMatrix::getData(bool imag) const {
     if (imag && !isComplex()) {
         return std::vector<double>();
     } else if (imag == isComplex()) {
-        return this->data_;
+        return std::vector<double>(this->data_.begin(), this->data_.end());
     }
 
     int elements = this->size();
@@ -525,6 +526,136 @@ std::vector<double> GEMatrix::getImagData() const {
     return ret;
 }
 
+/**
+ * Retrieve a copy of the matrix data with real and imaginary parts interleaved, which is the
+ * layout used by `std::complex<double>` and numpy `complex128`. Real matrices are returned with
+ * imaginary parts of `0`.
+ *
+ * Example:
+ *
+__Python__
+```py
+ge.executeString("x = complex({ 1 2, 3 4 }, { 5 6, 7 8 })")
+x = ge.getMatrix("x")
+print(", ".join(str(n) for n in x.getInterleavedData()))
+```
+ *
+__PHP__
+```php
+$ge->executeString("x = complex({ 1 2, 3 4 }, { 5 6, 7 8 });");
+$x = $ge->getMatrix("x");
+echo implode(", ", $x->getInterleavedData());
+```
+ * results in output:
+```
+1.0, 5.0, 2.0, 6.0, 3.0, 7.0, 4.0, 8.0
+```
+ *
+ * @return        Double precision std::vector of `2 * size()` elements
+ *
+ * @see setInterleavedData(const double*, size_t, int, int)
+ * @see getData(bool)
+ */
+std::vector<double> GEMatrix::getInterleavedData() const {
+    std::vector<double> ret(2 * static_cast<size_t>(this->size()));
+
+    if (!getInterleavedData(ret.data(), ret.size()))
+        return std::vector<double>();
+
+    return ret;
+}
+
+/**
+ * Write the matrix data with real and imaginary parts interleaved into _dest_, which must
+ * hold _len_ >= `2 * size()` elements.
+ *
+ * @param dest        Destination buffer
+ * @param len        Number of elements available in _dest_
+ * @return        True on success, false if _dest_ is too small.
+ */
+bool GEMatrix::getInterleavedData(double *dest, size_t len) const {
+    size_t elements = this->size();
+
+    if (!dest || len < 2 * elements || this->data_.size() < elements * (isComplex() ? 2 : 1))
+        return false;
+
+    interleaveComplex(this->data_.data(), isComplex() ? this->data_.data() + elements : nullptr, dest, elements);
+
+    return true;
+}
+
+/**
+ * Retrieve a copy of the matrix data as `std::complex<double>` values.
+ *
+ * @return        Vector of `size()` complex values
+ *
+ * @see getInterleavedData()
+ */
+std::vector<std::complex<double> > GEMatrix::getComplexData() const {
+    std::vector<std::complex<double> > ret(this->size());
+
+    // std::complex<double> is layout compatible with double[2]
+    if (!getInterleavedData(reinterpret_cast<double*>(ret.data()), 2 * ret.size()))
+        return std::vector<std::complex<double> >();
+
+    return ret;
+}
+
+/**
+ * Replace the matrix contents with _rows_ x _cols_ complex values, given with real and imaginary
+ * parts interleaved. The matrix becomes complex.
+ *
+ * Example:
+ *
+__Python__
+```py
+import numpy as np
+x = GEMatrix()
+x.setInterleavedData(np.array([[1+5j, 2+6j]]), 1, 2)
+ge.setSymbol(x, "x")
+ge.executeString("print x")
+```
+ * results in output:
+```
+       1.0000000 +        5.0000000i        2.0000000 +        6.0000000i
+```
+ *
+ * @param interleaved_data        Interleaved complex data
+ * @param interleaved_len        Element count of _interleaved_data_, must be `2 * rows * cols`
+ * @param rows        Row count
+ * @param cols        Column count
+ * @return        True on success, false otherwise
+ *
+ * @see getInterleavedData()
+ */
+bool GEMatrix::setInterleavedData(const double *interleaved_data, size_t interleaved_len, int rows, int cols) {
+    if (!interleaved_data || rows < 1 || cols < 1)
+        return false;
+
+    size_t elements = static_cast<size_t>(rows) * cols;
+
+    if (interleaved_len != 2 * elements)
+        return false;
+
+    this->data_.resize(2 * elements);
+    splitComplex(interleaved_data, this->data_.data(), this->data_.data() + elements, elements);
+
+    this->setRows(rows);
+    this->setCols(cols);
+    this->setComplex(true);
+
+    return true;
+}
+
+/**
+ * Replace the matrix contents with _rows_ x _cols_ `std::complex<double>` values. The matrix becomes complex.
+ *
+ * @see setInterleavedData(const double*, size_t, int, int)
+ */
+bool GEMatrix::setComplexData(const std::complex<double> *data, int rows, int cols) {
+    return setInterleavedData(reinterpret_cast<const double*>(data), 2 * static_cast<size_t>(rows) * cols, rows, cols);
+}
+
 std::string GEMatrix::toString() const {
     std::stringstream s;
 
@@ -2,8 +2,10 @@
 #define GEMATRIX_H
 
 #include "gesymbol.h"
+#include "gebuffer.h"
 #include <stdio.h>
 #include <memory>
+#include <complex>
 
 /**
  * GAUSS Matrix symbol type. Represents two dimensional array of double precision numbers. Matrices can
@@ -32,11 +34,23 @@ public:
     std::vector<double> getData(bool imag = false) const;
     std::vector<double> getImagData() const;
 
+    std::vector<double> getInterleavedData() const;
+    bool setInterleavedData(const double *interleaved_data, size_t interleaved_len, int rows, int cols);
+
     virtual void clear();
     virtual std::string toString() const;
 
     Matrix_t* toInternal();
 
+#ifndef SWIG
+    double* data() { return this->data_.data(); }               /**< Pointer to real data, followed by imaginary data if complex. */
+    const double* data() const { return this->data_.data(); }   /**< Pointer to real data, followed by imaginary data if complex. */
+
+    bool getInterleavedData(double *dest, size_t len) const;
+    std::vector<std::complex<double> > getComplexData() const;
+    bool setComplexData(const std::complex<double> *data, int rows, int cols);
+#endif
+
 #ifdef SWIGPHP
     int position_;
 #endif
@@ -49,10 +63,12 @@ private:
     void Init(VECTOR_DATA(double) real_data, VECTOR_DATA(double) imag_data, int rows, int cols, bool complex = false);
     void Init(const double *data, const double *imag_data, int rows, int cols, bool complex = false); 
 
-    std::vector<double> data_;
+    GEBuffer data_;
 
     friend class GAUSS;
     friend class GAUSSPrivate;
+    friend class GEArray;
+    friend class GEProcCall;
 };
 
 #endif // GEMATRIX_H
@@ -0,0 +1,283 @@
+#include "gematrixview.h"
+#include "geworkspace.h"
+#include "gauss_p.h"
+#include <sstream>
+
+/**
+  * Internal use only. Construct a view from symbol info retrieved with GAUSS_GetMatrixInfo.
+  */
+GEMatrixView::GEMatrixView(const GAUSS_MatrixInfo_t &info, const std::string &name, GEWorkspace *workspace) {
+    this->data_ = info.maddr;
+    this->rows_ = info.rows;
+    this->cols_ = info.cols;
+    this->complex_ = static_cast<bool>(info.complex);
+    this->name_ = name;
+    this->workspace_ = workspace->handleRef();
+    this->workspaceEpoch_ = workspace->epochRef();
+    this->epoch_ = workspace->epochRef().lock()->load();
+    this->globalEpoch_ = GAUSSPrivate::symbolEpoch_.load();
+    this->valid_ = (this->data_ != nullptr);
+}
+
+GEMatrixView::~GEMatrixView() {
+}
+
+/**
+ * Verify the view still references the current symbol memory. If a symbol of
+ * the view's workspace has been written since the last check, the symbol info is
+ * looked up again and compared against the view. Writes to other workspaces do not
+ * trigger a lookup. Once invalid, a view stays invalid.
+ */
+bool GEMatrixView::check() const {
+    if (!this->valid_)
+        return false;
+
+    std::shared_ptr<WorkspaceHandle_t*> wh = this->workspace_.lock();
+    std::shared_ptr<std::atomic<unsigned int> > workspaceEpoch = this->workspaceEpoch_.lock();
+
+    if (!wh || !*wh || !workspaceEpoch) {
+        this->valid_ = false;
+        return false;
+    }
+
+    unsigned int epoch = workspaceEpoch->load();
+    unsigned int globalEpoch = GAUSSPrivate::symbolEpoch_.load();
+
+    if (epoch == this->epoch_ && globalEpoch == this->globalEpoch_)
+        return true;
+
+    GAUSS_MatrixInfo_t info;
+    std::string name = this->name_;
+
+    if (GAUSS_GetMatrixInfo(*wh, &info, const_cast<char*>(name.c_str())) ||
+            info.maddr != this->data_ ||
+            info.rows != this->rows_ ||
+            info.cols != this->cols_ ||
+            static_cast<bool>(info.complex) != this->complex_) {
+        this->valid_ = false;
+        return false;
+    }
+
+    this->epoch_ = epoch;
+    this->globalEpoch_ = globalEpoch;
+
+    return true;
+}
+
+/**
+ * Returns whether this view still references valid symbol table memory. A view is
+ * invalidated when its workspace is freed, or when the symbol is reassigned
+ * or cleared.
+ *
+ * Example:
+ *
+__Python__
+```py
+ge.executeString("x = rndn(3,3)")
+xv = ge.getMatrixView("x")
+print(xv.isValid())
+ge.executeString("x = 5")
+print(xv.isValid())
+```
+ *
+__PHP__
+```php
+$ge->executeString("x = rndn(3,3)");
+$xv = $ge->getMatrixView("x");
+var_dump($xv->isValid());
+$ge->executeString("x = 5");
+var_dump($xv->isValid());
+```
+ * will result in the output:
+```
+True
+False
+```
+ *
+ * @return True if the view can be read from, false otherwise.
+ */
+bool GEMatrixView::isValid() const {
+    return check();
+}
+
+/**
+ * Return row count.
+ */
+int GEMatrixView::getRows() const {
+    return this->rows_;
+}
+
+/**
+ * Return column count.
+ */
+int GEMatrixView::getCols() const {
+    return this->cols_;
+}
+
+/**
+ * Return if data is complex.
+ */
+bool GEMatrixView::isComplex() const {
+    return this->complex_;
+}
+
+/**
+ * Return element count. For complex matrices this is the number of complex elements.
+ */
+int GEMatrixView::size() const {
+    return this->rows_ * this->cols_;
+}
+
+/**
+ * Return the distance in elements between consecutive rows. Data is stored in row-major order.
+ */
+int GEMatrixView::getRowStride() const {
+    return this->cols_;
+}
+
+/**
+ * Return the distance in elements between consecutive columns. Data is stored in row-major order.
+ */
+int GEMatrixView::getColStride() const {
+    return 1;
+}
+
+/**
+ * Convenience method for scalars. Equivalent to getElement(0, imag).
+ *
+ * @param imag        True for imaginary data, false for real
+ * @return        First value of matrix
+ *
+ * @see getElement(int, bool)
+ */
+double GEMatrixView::getElement(bool imag) const {
+    return getElement(0, imag);
+}
+
+/**
+ * Returns a value from the matrix at the specified index. Negative
+ * indices count from the end of the data.
+ *
+ * @param index        Index
+ * @param imag        True for imaginary data, false for real
+ * @return        Double precision number at index, or 0 if out of range or the view is invalid.
+ *
+ * @see getElement(int, int, bool)
+ */
+double GEMatrixView::getElement(int index, bool imag) const {
+    if (!isComplex() && imag)
+        return 0;
+
+    if (index < 0)
+        index += size();
+
+    if (index < 0 || index >= size() || !check())
+        return 0;
+
+    return this->data_[index + (imag ? size() : 0)];
+}
+
+/**
+ * Returns a value from the matrix at the specified row/column index.
+ *
+ * @param row        Row index
+ * @param col        Column index
+ * @param imag        True for imaginary data, false for real
+ * @return        Double precision number at row/column coordinates, or 0 if out of range or the view is invalid.
+ *
+ * @see getElement(int, bool)
+ */
+double GEMatrixView::getElement(int row, int col, bool imag) const {
+    if (!isComplex() && imag)
+        return 0;
+    else if (row < 0 || col < 0 || row >= getRows() || col >= getCols())
+        return 0;
+
+    return getElement(row * getRowStride() + col * getColStride(), imag);
+}
+
+/**
+ * Returns a copy of the real or imaginary data referenced by this view.
+ *
+ * @param imag        True for imaginary data, false for real
+ * @return        Vector of data, empty if the view is invalid.
+ *
+ * @see getImagData()
+ */
+std::vector<double> GEMatrixView::getData(bool imag) const {
+    const double *start = data(imag);
+
+    if (!start)
+        return std::vector<double>();
+
+    return std::vector<double>(start, start + size());
+}
+
+/**
+ * Convenience method equivalent to getData(true).
+ *
+ * @see getData(bool)
+ */
+std::vector<double> GEMatrixView::getImagData() const {
+    return getData(true);
+}
+
+/**
+ * Returns a pointer to the real or imaginary data referenced by this view. The pointer
+ * is owned by the GAUSS symbol table and must not be freed.
+ *
+ * @param imag        True for imaginary data, false for real
+ * @return        Data pointer, or nullptr if the view is invalid.
+ */
+const double* GEMatrixView::data(bool imag) const {
+    if ((!isComplex() && imag) || !check())
+        return nullptr;
+
+    return this->data_ + (imag ? size() : 0);
+}
+
+/**
+ * Iterator to the first real (or imaginary) value.
+ */
+GEMatrixView::const_iterator GEMatrixView::begin(bool imag) const {
+    return data(imag);
+}
+
+/**
+ * Iterator past the last real (or imaginary) value.
+ */
+GEMatrixView::const_iterator GEMatrixView::end(bool imag) const {
+    const double *start = data(imag);
+    return start ? start + size() : nullptr;
+}
+
+/**
+ * Returns a std::string representation of this view, formatted the same as GEMatrix::toString().
+ */
+std::string GEMatrixView::toString() const {
+    std::stringstream s;
+
+    if (!check())
+        return s.str();
+
+    int rows = getRows();
+    int cols = getCols();
+    bool complex = isComplex();
+
+    for (int i = 0; i < rows; ++i) {
+        for (int j = 0; j < cols; ++j) {
+            s << this->data_[i * cols + j];
+
+            if (complex)
+                s << " + " << this->data_[size() + i * cols + j];
+
+            if (j < cols - 1)
+                s << "\t";
+        }
+
+        if (i < rows - 1)
+            s << std::endl;
+    }
+
+    return s.str();
+}
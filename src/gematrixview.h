@@ -0,0 +1,80 @@
+#ifndef GEMATRIXVIEW_H
+#define GEMATRIXVIEW_H
+
+#include "gauss.h"
+#include <string>
+#include <vector>
+#include <memory>
+#include <atomic>
+
+/**
+ * Read-only view of a GAUSS matrix that references the symbol table memory directly,
+ * rather than copying it like GEMatrix does.
+ *
+ * The view is checked before each access: it becomes invalid once the owning workspace
+ * is freed, or once the symbol has been reassigned to different memory. Accessors on an
+ * invalid view return `0` (or empty data), and isValid() can be used to test for this.
+ *
+ * Views are not synchronized with the engine, and a view is only re-checked after writes
+ * through GAUSS to its own workspace. A view must not be read while its workspace is
+ * executing, or being written, on another thread.
+ */
+class GAUSS_EXPORT GEMatrixView
+{
+public:
+    ~GEMatrixView();
+
+    bool isValid() const;
+
+    int getRows() const;
+    int getCols() const;
+    bool isComplex() const;
+    int size() const;
+
+    int getRowStride() const;
+    int getColStride() const;
+
+    double getElement(bool imag = false) const;
+    double getElement(int idx, bool imag = false) const;
+    double getElement(int row, int col, bool imag = false) const;
+
+    std::vector<double> getData(bool imag = false) const;
+    std::vector<double> getImagData() const;
+
+    std::string toString() const;
+
+#ifndef SWIG
+    /**
+     * Forward iterator over the real (or imaginary) values of a view, in row-major order.
+     */
+    typedef const double* const_iterator;
+
+    const double* data(bool imag = false) const;
+
+    const_iterator begin(bool imag = false) const;
+    const_iterator end(bool imag = false) const;
+#endif
+
+private:
+    GEMatrixView(const GAUSS_MatrixInfo_t &info, const std::string &name, GEWorkspace *workspace);
+    GEMatrixView(const GEMatrixView&);
+    GEMatrixView& operator=(const GEMatrixView&);
+
+    bool check() const;
+
+    const double *data_;
+    size_t rows_;
+    size_t cols_;
+    bool complex_;
+
+    std::string name_;
+    std::weak_ptr<WorkspaceHandle_t*> workspace_;
+    std::weak_ptr<std::atomic<unsigned int> > workspaceEpoch_;
+    mutable unsigned int epoch_;
+    mutable unsigned int globalEpoch_;
+    mutable bool valid_;
+
+    friend class GAUSS;
+};
+
+#endif // GEMATRIXVIEW_H
@@ -0,0 +1,324 @@
+#include "geproccall.h"
+#include "gearray.h"
+#include "gematrix.h"
+#include "gestringarray.h"
+#include "gauss_p.h"
+#include <memory>
+
+/**
+ * Create a call to the procedure _name_ with no arguments. The procedure must be defined in
+ * the workspace of the program it is called with.
+ *
+ * Example:
+ *
+__Python__
+```py
+ge.executeString("proc (2) = sumprod(x, y); retp(x + y, x .* y); endp;")
+
+call = GEProcCall("sumprod")
+call.addArg(GEMatrix([1.0, 2.0, 3.0]))
+call.addArg(4.0)
+
+if ge.callProc(call):
+    print(list(call.getReturn(0).getData()))
+    print(list(call.getReturn(1).getData()))
+```
+ * will result in the output:
+```
+[5.0, 6.0, 7.0]
+[4.0, 8.0, 12.0]
+```
+ *
+ * @param name        Procedure name
+ */
+GEProcCall::GEProcCall(std::string name) : name_(name), args_(nullptr), keep_args_(false) {
+}
+
+GEProcCall::~GEProcCall() {
+    clearReturns();
+    clearArgs();
+}
+
+/**
+ * Return the procedure name.
+ */
+std::string GEProcCall::name() const {
+    return this->name_;
+}
+
+/**
+ * Set the procedure name. Arguments that were already added are kept.
+ *
+ * @param name        Procedure name
+ */
+void GEProcCall::setName(std::string name) {
+    this->name_ = name;
+}
+
+/** \internal */
+ArgList_t* GEProcCall::argList() {
+    if (!this->args_)
+        this->args_ = GAUSS_CreateArgList();
+
+    return this->args_;
+}
+
+/**
+ * Append a scalar argument.
+ *
+ * @param value        Argument value
+ * @return        True on success, false on failure
+ */
+bool GEProcCall::addArg(double value) {
+    ArgList_t *args = argList();
+
+    // Argument number 0 appends to the end of the list
+    return args && GAUSS_PutDoubleInArg(args, value, 0) == GAUSS_SUCCESS;
+}
+
+/**
+ * Append a copy of a matrix as an argument. The matrix is left unchanged; use moveArg(GEMatrix*)
+ * to avoid the copy.
+ *
+ * @param matrix        Matrix argument
+ * @return        True on success, false on failure
+ */
+bool GEProcCall::addArg(GEMatrix *matrix) {
+    ArgList_t *args = argList();
+
+    if (!args || !matrix)
+        return false;
+
+    std::unique_ptr<Matrix_t> newMat(matrix->toInternal());
+
+    return GAUSS_CopyMatrixToArg(args, newMat.get(), 0) == GAUSS_SUCCESS;
+}
+
+/**
+ * Append a copy of an array as an argument. The array is left unchanged; use moveArg(GEArray*)
+ * to avoid the copy.
+ *
+ * @param array        Array argument
+ * @return        True on success, false on failure
+ */
+bool GEProcCall::addArg(GEArray *array) {
+    ArgList_t *args = argList();
+
+    if (!args || !array)
+        return false;
+
+    std::unique_ptr<Array_t> newArray(array->toInternal());
+
+    if (!newArray.get())
+        return false;
+
+    return GAUSS_CopyArrayToArg(args, newArray.get(), 0) == GAUSS_SUCCESS;
+}
+
+/**
+ * Append a matrix as an argument without copying it. The data is handed to the argument list and
+ * the local object is cleared afterwards, regardless of the result.
+ *
+ * Example:
+ *
+__Python__
+```py
+call = GEProcCall("ols")
+call.moveArg(GEMatrix(y, 10000, 1))    # no copy of the 10000 values
+```
+ *
+ * @param matrix        Matrix argument
+ * @return        True on success, false on failure
+ *
+ * @see addArg(GEMatrix*)
+ */
+bool GEProcCall::moveArg(GEMatrix *matrix) {
+    ArgList_t *args = argList();
+
+    if (!args || !matrix)
+        return false;
+
+    Matrix_t *newMat = GAUSS_MallocMatrix_t();
+
+    if (!newMat)
+        return false;
+
+    newMat->rows = matrix->getRows();
+    newMat->cols = matrix->getCols();
+    newMat->complex = matrix->isComplex();
+    newMat->mdata = matrix->data_.release(); // Allocated with GAUSS_Malloc, the engine takes ownership
+    newMat->freeable = TRUE;
+
+    int ret = GAUSS_MoveMatrixToArg(args, newMat, 0);
+
+    matrix->clear();
+
+    return ret == GAUSS_SUCCESS;
+}
+
+/**
+ * Append an array as an argument without copying it. The data is handed to the argument list and
+ * the local object is cleared afterwards, regardless of the result.
+ *
+ * @param array        Array argument
+ * @return        True on success, false on failure
+ *
+ * @see addArg(GEArray*)
+ */
+bool GEProcCall::moveArg(GEArray *array) {
+    ArgList_t *args = argList();
+
+    if (!args || !array || !array->getDimensions() || !array->size())
+        return false;
+
+    Array_t *newArray = GAUSS_MallocArray_t();
+
+    if (!newArray)
+        return false;
+
+    newArray->dims = array->getDimensions();
+    newArray->nelems = array->size();
+    newArray->complex = static_cast<int>(array->isComplex());
+    newArray->adata = array->data_.release(); // Orders followed by data, allocated with GAUSS_Malloc
+    newArray->freeable = TRUE;
+
+    int ret = GAUSS_MoveArrayToArg(args, newArray, 0);
+
+    array->clear();
+
+    return ret == GAUSS_SUCCESS;
+}
+
+/**
+ * Append a copy of a string array as an argument.
+ *
+ * @param sa        String array argument
+ * @return        True on success, false on failure
+ */
+bool GEProcCall::addArg(GEStringArray *sa) {
+    ArgList_t *args = argList();
+
+    if (!args || !sa)
+        return false;
+
+    StringArray_t *newSa = sa->toInternal();
+
+    if (!newSa)
+        return false;
+
+    return GAUSS_MoveStringArrayToArg(args, newSa, 0) == GAUSS_SUCCESS;
+}
+
+/**
+ * Append a string argument.
+ *
+ * @param str        String argument
+ * @return        True on success, false on failure
+ */
+bool GEProcCall::addArg(std::string str) {
+    ArgList_t *args = argList();
+
+    if (!args)
+        return false;
+
+    String_t *newStr = GAUSS_String(const_cast<char*>(str.c_str()));
+
+    if (!newStr)
+        return false;
+
+    return GAUSS_MoveStringToArg(args, newStr, 0) == GAUSS_SUCCESS;
+}
+
+/**
+ * Return the number of arguments added.
+ */
+int GEProcCall::getArgCount() const {
+    return this->args_ ? this->args_->num : 0;
+}
+
+/**
+ * Remove all arguments.
+ */
+void GEProcCall::clearArgs() {
+    if (this->args_)
+        GAUSS_FreeArgList(this->args_);
+
+    this->args_ = nullptr;
+}
+
+/**
+ * Set whether the arguments are kept after a call, so the same arguments can be used for
+ * repeated calls. By default the argument list is handed to the engine and freed by the call,
+ * which avoids copying it.
+ *
+ * @param keep        True to keep arguments between calls
+ */
+void GEProcCall::setKeepArgs(bool keep) {
+    this->keep_args_ = keep;
+}
+
+/**
+ * Return whether the arguments are kept after a call.
+ */
+bool GEProcCall::keepArgs() const {
+    return this->keep_args_;
+}
+
+/**
+ * Return the number of values returned by the last call.
+ */
+int GEProcCall::getReturnCount() const {
+    return this->returns_.size();
+}
+
+/**
+ * Return the symbol type of a return value, or 0 if _index_ is out of range.
+ *
+ * @param index        0-based return value index
+ * @return        int that represents symbol type. Refer to GESymType const list.
+ */
+int GEProcCall::getReturnType(int index) const {
+    if (index < 0 || index >= getReturnCount() || !this->returns_.at(index))
+        return 0;
+
+    return this->returns_.at(index)->type();
+}
+
+/**
+ * Return a value returned by the last call. The symbol is owned by this object, and is
+ * only valid until the next call or clearReturns().
+ *
+ * @param index        0-based return value index
+ * @return        GEMatrix, GEArray or GEStringArray object, or `nullptr` if _index_ is out of range
+ *                or the value has an unsupported type.
+ */
+GESymbol* GEProcCall::getReturn(int index) const {
+    if (index < 0 || index >= getReturnCount())
+        return nullptr;
+
+    return this->returns_.at(index);
+}
+
+/**
+ * Free the values returned by the last call.
+ */
+void GEProcCall::clearReturns() {
+    for (size_t i = 0; i < this->returns_.size(); ++i)
+        GAUSSPrivate::freeSymbol(this->returns_.at(i));
+
+    this->returns_.clear();
+}
+
+/** \internal */
+void GEProcCall::setReturns(ArgList_t *ret) {
+    clearReturns();
+
+    if (!ret)
+        return;
+
+    // Engine argument numbers start at 1
+    for (int i = 1; i <= ret->num; ++i)
+        this->returns_.push_back(GAUSSPrivate::moveArgToSymbol(ret, i));
+
+    GAUSS_FreeArgList(ret);
+}
@@ -0,0 +1,62 @@
+#ifndef GEPROCCALL_H
+#define GEPROCCALL_H
+
+#include "gauss.h"
+#include <string>
+#include <vector>
+
+class GESymbol;
+
+/**
+ * Arguments and return values for a direct call to a GAUSS procedure, made with
+ * GAUSS::callProc(). Arguments are placed in an engine argument list as they are added, so the
+ * procedure is called without assigning globals or compiling any code. addArg() copies matrices
+ * and arrays, leaving the caller's object intact; moveArg() hands their data to the argument list
+ * without a copy.
+ *
+ * Return values are kept by this object until the next call, clearReturns() or its
+ * destruction, and getReturn() hands out references to them.
+ */
+class GAUSS_EXPORT GEProcCall
+{
+public:
+    GEProcCall(std::string name);
+    ~GEProcCall();
+
+    std::string name() const;
+    void setName(std::string name);
+
+    bool addArg(double value);
+    bool addArg(GEMatrix *matrix);
+    bool addArg(GEArray *array);
+    bool addArg(GEStringArray *sa);
+    bool addArg(std::string str);
+    bool moveArg(GEMatrix *matrix);
+    bool moveArg(GEArray *array);
+    int getArgCount() const;
+    void clearArgs();
+
+    void setKeepArgs(bool keep);
+    bool keepArgs() const;
+
+    int getReturnCount() const;
+    int getReturnType(int index) const;
+    GESymbol* getReturn(int index) const;
+    void clearReturns();
+
+private:
+    GEProcCall(const GEProcCall&);
+    GEProcCall& operator=(const GEProcCall&);
+
+    ArgList_t* argList();
+    void setReturns(ArgList_t *ret);
+
+    std::string name_;
+    ArgList_t *args_;
+    bool keep_args_;
+    std::vector<GESymbol*> returns_;
+
+    friend class GAUSS;
+};
+
+#endif // GEPROCCALL_H
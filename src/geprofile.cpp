@@ -0,0 +1,381 @@
+#include "geprofile.h"
+#include <sstream>
+#include <map>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+
+static bool parseNumber(const std::string &token, double *value) {
+    if (token.empty())
+        return false;
+
+    char *end = nullptr;
+    *value = strtod(token.c_str(), &end);
+
+    return end && *end == '\0';
+}
+
+static std::string jsonEscape(const std::string &str) {
+    std::string ret;
+    ret.reserve(str.size() + 2);
+
+    for (size_t i = 0; i < str.size(); ++i) {
+        const unsigned char c = str[i];
+
+        switch (c) {
+        case '"':  ret += "\\\""; break;
+        case '\\': ret += "\\\\"; break;
+        case '\n': ret += "\\n"; break;
+        case '\r': ret += "\\r"; break;
+        case '\t': ret += "\\t"; break;
+        default:
+            if (c < 0x20) {
+                char buf[8];
+                snprintf(buf, sizeof(buf), "\\u%04x", c);
+                ret += buf;
+            } else {
+                ret += c;
+            }
+        }
+    }
+
+    return ret;
+}
+
+static std::string formatNumber(double value) {
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%.15g", value);
+    return buf;
+}
+
+/**
+ * Construct an empty profile.
+ */
+GEProfile::GEProfile() {
+}
+
+/**
+ * Construct a profile from the report written by `GAUSS_ProfileExecute`.
+ *
+ * Each record of the report is a line of whitespace separated fields: the procedure name,
+ * optionally followed by the file name, and ending in the line number, the execution count and
+ * the time in seconds. A record with line number `0`, or with the line number omitted, is the
+ * total of its procedure. Lines with fewer than two trailing numbers, such as headers, are
+ * skipped. For example:
+```
+Procedure       File            Line    Count   Time
+main            prog.gss        0       1       2.5
+main            prog.gss        2       10      1.5
+main            prog.gss        3       1       0.5
+helper          lib.src         5       0.25
+```
+ * Here `main` is profiled by line, so its total record is ignored by the aggregate functions,
+ * while `helper` only has a total and contributes that.
+ *
+ * @param report        Profile report text
+ */
+GEProfile::GEProfile(const std::string &report) : raw_(report) {
+    parse();
+}
+
+void GEProfile::parse() {
+    std::istringstream lines(this->raw_);
+    std::string text;
+
+    while (std::getline(lines, text)) {
+        std::istringstream fields(text);
+        std::vector<std::string> tokens;
+        std::string token;
+
+        while (fields >> token)
+            tokens.push_back(token);
+
+        // Split off the trailing numeric fields
+        std::vector<double> numbers;
+        size_t names = tokens.size();
+        double value = 0;
+
+        while (names > 0 && numbers.size() < 3 && parseNumber(tokens[names - 1], &value)) {
+            numbers.insert(numbers.begin(), value);
+            --names;
+        }
+
+        if (numbers.size() < 2 || names == 0)
+            continue;
+
+        Entry entry;
+        entry.proc = tokens[0];
+        entry.file = names > 1 ? tokens[1] : std::string();
+        entry.line = numbers.size() == 3 ? (int)numbers[0] : 0;
+        entry.count = numbers[numbers.size() - 2];
+        entry.time = numbers[numbers.size() - 1];
+
+        if (std::find(this->procs_.begin(), this->procs_.end(), entry.proc) == this->procs_.end())
+            this->procs_.push_back(entry.proc);
+
+        if (entry.line > 0)
+            this->entries_.push_back(entry);
+        else
+            this->totals_.push_back(entry);
+    }
+}
+
+bool GEProfile::validIndex(int index) const {
+    return index >= 0 && index < getEntryCount();
+}
+
+bool GEProfile::hasLines(const std::string &proc) const {
+    for (size_t i = 0; i < this->entries_.size(); ++i) {
+        if (this->entries_.at(i).proc == proc)
+            return true;
+    }
+
+    return false;
+}
+
+const GEProfile::Entry* GEProfile::procTotal(const std::string &proc) const {
+    for (size_t i = 0; i < this->totals_.size(); ++i) {
+        if (this->totals_.at(i).proc == proc)
+            return &this->totals_.at(i);
+    }
+
+    return nullptr;
+}
+
+/**
+ * Return the number of profiled lines. Procedure totals are not counted.
+ */
+int GEProfile::getEntryCount() const {
+    return this->entries_.size();
+}
+
+/**
+ * Return the procedure an entry belongs to.
+ *
+ * @param index        0-based entry index
+ */
+std::string GEProfile::getProc(int index) const {
+    return validIndex(index) ? this->entries_.at(index).proc : std::string();
+}
+
+/**
+ * Return the source file of an entry, or an empty string if the report does not name one.
+ *
+ * @param index        0-based entry index
+ */
+std::string GEProfile::getFile(int index) const {
+    return validIndex(index) ? this->entries_.at(index).file : std::string();
+}
+
+/**
+ * Return the line number of an entry.
+ *
+ * @param index        0-based entry index
+ */
+int GEProfile::getLine(int index) const {
+    return validIndex(index) ? this->entries_.at(index).line : 0;
+}
+
+/**
+ * Return the number of times an entry was executed.
+ *
+ * @param index        0-based entry index
+ */
+double GEProfile::getCount(int index) const {
+    return validIndex(index) ? this->entries_.at(index).count : 0;
+}
+
+/**
+ * Return the time spent in an entry, in seconds.
+ *
+ * @param index        0-based entry index
+ */
+double GEProfile::getTime(int index) const {
+    return validIndex(index) ? this->entries_.at(index).time : 0;
+}
+
+/**
+ * Return the time of all procedures, in seconds.
+ *
+ * @see getProcTime()
+ */
+double GEProfile::getTotalTime() const {
+    double total = 0;
+
+    for (size_t i = 0; i < this->procs_.size(); ++i)
+        total += getProcTime(this->procs_.at(i));
+
+    return total;
+}
+
+/**
+ * Return the total time spent in the lines of procedure _proc_, in seconds. If the report has no
+ * line records for _proc_, its procedure total is returned instead.
+ *
+ * @param proc        Procedure name
+ */
+double GEProfile::getProcTime(std::string proc) const {
+    if (!hasLines(proc)) {
+        const Entry *total = procTotal(proc);
+        return total ? total->time : 0;
+    }
+
+    double total = 0;
+
+    for (size_t i = 0; i < this->entries_.size(); ++i) {
+        if (this->entries_.at(i).proc == proc)
+            total += this->entries_.at(i).time;
+    }
+
+    return total;
+}
+
+/**
+ * Return the total execution count of the lines of procedure _proc_. If the report has no line
+ * records for _proc_, the count of its procedure total is returned instead.
+ *
+ * @param proc        Procedure name
+ */
+double GEProfile::getProcCount(std::string proc) const {
+    if (!hasLines(proc)) {
+        const Entry *total = procTotal(proc);
+        return total ? total->count : 0;
+    }
+
+    double total = 0;
+
+    for (size_t i = 0; i < this->entries_.size(); ++i) {
+        if (this->entries_.at(i).proc == proc)
+            total += this->entries_.at(i).count;
+    }
+
+    return total;
+}
+
+/**
+ * Return the names of all profiled procedures, in the order they first appear.
+ */
+std::vector<std::string> GEProfile::getProcs() const {
+    return this->procs_;
+}
+
+/**
+ * Export the profile as JSON. The result holds the total time and a list of procedures, each
+ * with its totals and its lines.
+ *
+ * Example:
+ *
+__Python__
+```py
+profile = ge.profileProgram(ph)
+print(profile.toJson())
+```
+ * will result in output similar to:
+```
+{"totalTime":0.012,"procs":[{"name":"main","file":"","count":3,"time":0.012,"lines":[{"line":1,"count":1,"time":0.002}, ...]}]}
+```
+ */
+std::string GEProfile::toJson() const {
+    std::vector<std::string> procs = getProcs();
+    std::string json = "{\"totalTime\":" + formatNumber(getTotalTime()) + ",\"procs\":[";
+
+    for (size_t p = 0; p < procs.size(); ++p) {
+        const std::string &proc = procs.at(p);
+        const Entry *total = procTotal(proc);
+        std::string file = total ? total->file : std::string();
+        std::string lines;
+
+        for (size_t i = 0; i < this->entries_.size(); ++i) {
+            const Entry &entry = this->entries_.at(i);
+
+            if (entry.proc != proc)
+                continue;
+
+            if (file.empty())
+                file = entry.file;
+
+            if (!lines.empty())
+                lines += ",";
+
+            lines += "{\"line\":" + formatNumber(entry.line) +
+                     ",\"count\":" + formatNumber(entry.count) +
+                     ",\"time\":" + formatNumber(entry.time) + "}";
+        }
+
+        if (p > 0)
+            json += ",";
+
+        json += "{\"name\":\"" + jsonEscape(proc) +
+                "\",\"file\":\"" + jsonEscape(file) +
+                "\",\"count\":" + formatNumber(getProcCount(proc)) +
+                ",\"time\":" + formatNumber(getProcTime(proc)) +
+                ",\"lines\":[" + lines + "]}";
+    }
+
+    json += "]}";
+
+    return json;
+}
+
+/**
+ * Export the profile in the folded stack format read by flame graph tools: one line per entry,
+ * with the frames `procedure;line` separated by semicolons and followed by the time in
+ * microseconds. A procedure without line records is written as a single frame holding its
+ * procedure total; otherwise its total is left out, so the procedure frame has no self time.
+ *
+ * Example:
+ *
+__Python__
+```py
+with open("profile.folded", "w") as f:
+    f.write(ge.profileProgram(ph).toFoldedStacks())
+
+# flamegraph.pl profile.folded > profile.svg
+```
+ */
+std::string GEProfile::toFoldedStacks() const {
+    // Merge duplicate frames, keeping the order of first appearance
+    std::vector<std::string> stacks;
+    std::map<std::string, double> totals;
+
+    for (size_t i = 0; i < this->entries_.size(); ++i) {
+        const Entry &entry = this->entries_.at(i);
+        std::ostringstream frame;
+        frame << entry.proc << ";" << (entry.file.empty() ? entry.proc : entry.file) << ":" << entry.line;
+        std::string stack = frame.str();
+
+        if (!totals.count(stack))
+            stacks.push_back(stack);
+
+        totals[stack] += entry.time * 1e6;
+    }
+
+    for (size_t i = 0; i < this->totals_.size(); ++i) {
+        const Entry &entry = this->totals_.at(i);
+
+        if (hasLines(entry.proc))
+            continue;
+
+        if (!totals.count(entry.proc))
+            stacks.push_back(entry.proc);
+
+        totals[entry.proc] += entry.time * 1e6;
+    }
+
+    std::string ret;
+
+    for (size_t i = 0; i < stacks.size(); ++i) {
+        char value[32];
+        snprintf(value, sizeof(value), " %.0f\n", totals[stacks.at(i)]);
+        ret += stacks.at(i) + value;
+    }
+
+    return ret;
+}
+
+/**
+ * Return the report exactly as written by the engine.
+ */
+std::string GEProfile::getRawOutput() const {
+    return this->raw_;
+}
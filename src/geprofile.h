@@ -0,0 +1,60 @@
+#ifndef GEPROFILE_H
+#define GEPROFILE_H
+
+#include "gauss.h"
+#include <string>
+#include <vector>
+
+/**
+ * Execution profile of a program, returned by GAUSS::profileProgram(). The raw report written by
+ * the engine is parsed into one entry per profiled line, each with the procedure and file it
+ * belongs to, the number of times it ran and the time spent in it. Procedure totals reported by
+ * the engine are kept apart from the lines and only stand in for procedures without line records,
+ * so no time is counted twice.
+ *
+ * The profile can be exported as JSON with toJson(), or as folded stacks with toFoldedStacks()
+ * for flame graph tools. The unparsed report is available from getRawOutput().
+ */
+class GAUSS_EXPORT GEProfile
+{
+public:
+    GEProfile();
+    GEProfile(const std::string &report);
+
+    int getEntryCount() const;
+    std::string getProc(int index) const;
+    std::string getFile(int index) const;
+    int getLine(int index) const;
+    double getCount(int index) const;
+    double getTime(int index) const;
+
+    double getTotalTime() const;
+    double getProcTime(std::string proc) const;
+    double getProcCount(std::string proc) const;
+    std::vector<std::string> getProcs() const;
+
+    std::string toJson() const;
+    std::string toFoldedStacks() const;
+    std::string getRawOutput() const;
+
+private:
+    struct Entry {
+        std::string proc;
+        std::string file;
+        int line;
+        double count;
+        double time;
+    };
+
+    void parse();
+    bool validIndex(int index) const;
+    bool hasLines(const std::string &proc) const;
+    const Entry* procTotal(const std::string &proc) const;
+
+    std::string raw_;
+    std::vector<Entry> entries_;        // Per-line records
+    std::vector<Entry> totals_;         // Procedure total records
+    std::vector<std::string> procs_;    // Procedure names in order of first appearance
+};
+
+#endif // GEPROFILE_H
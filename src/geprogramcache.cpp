@@ -0,0 +1,215 @@
+#include "geprogramcache.h"
+#include "geworkspace.h"
+#include <functional>
+
+static void freeCachedProgram(ProgramHandle_t *ph) {
+    GAUSS_FreeProgram(ph);
+}
+
+/**
+ * Construct a disabled cache.
+ */
+GEProgramCache::GEProgramCache() : max_entries_(0), hits_(0), misses_(0) {
+}
+
+GEProgramCache::~GEProgramCache() {
+    clear();
+}
+
+size_t GEProgramCache::KeyHash::operator()(const Key &key) const {
+    size_t seed = std::hash<std::string>()(key.text);
+    seed ^= std::hash<void*>()(key.wh) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    seed ^= std::hash<int>()(key.kind) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    return seed;
+}
+
+/**
+ * Set the maximum number of compiled programs to keep. The least recently used programs are
+ * freed when the cache grows past this size. A value of `0` disables the cache and frees
+ * every cached program.
+ *
+ * Example:
+ *
+__Python__
+```py
+ge.getProgramCache().setMaxEntries(500)
+
+for i in range(0, 1000):
+    ge.executeString("x = rndu(3,3)")   # compiled once
+
+cache = ge.getProgramCache()
+print(cache.hits(), cache.misses())
+```
+ *
+ * will result in the output:
+```
+999 1
+```
+ *
+ * @param maxEntries        Maximum number of cached programs
+ */
+void GEProgramCache::setMaxEntries(int maxEntries) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    this->max_entries_ = maxEntries > 0 ? maxEntries : 0;
+    trim();
+}
+
+/**
+ * Return the maximum number of cached programs. The cache is disabled when this is `0`.
+ */
+int GEProgramCache::maxEntries() const {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return this->max_entries_;
+}
+
+/**
+ * Return the number of programs currently cached.
+ */
+int GEProgramCache::count() const {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return this->index_.size();
+}
+
+/**
+ * Return the number of executions that reused a cached program since the last resetStats().
+ */
+long long GEProgramCache::hits() const {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return this->hits_;
+}
+
+/**
+ * Return the number of executions that had to compile since the last resetStats().
+ * Only counted while the cache is enabled.
+ */
+long long GEProgramCache::misses() const {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return this->misses_;
+}
+
+/**
+ * Reset the hit and miss counters to `0`.
+ */
+void GEProgramCache::resetStats() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    this->hits_ = 0;
+    this->misses_ = 0;
+}
+
+/**
+ * Free every cached program. Programs that are currently executing are freed once they finish.
+ */
+void GEProgramCache::clear() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    this->index_.clear();
+    this->entries_.clear();
+}
+
+/**
+ * Free every program cached for _workspace_. This is done automatically when the workspace is
+ * destroyed through GAUSS.
+ *
+ * @param workspace        Workspace handle
+ */
+void GEProgramCache::invalidate(GEWorkspace *workspace) {
+    if (workspace)
+        invalidate(workspace->workspace());
+}
+
+/** \internal */
+void GEProgramCache::invalidate(WorkspaceHandle_t *wh) {
+    if (!wh)
+        return;
+
+    std::lock_guard<std::mutex> guard(mutex_);
+
+    for (EntryList::iterator it = this->entries_.begin(); it != this->entries_.end();) {
+        if (it->key.wh == wh) {
+            this->index_.erase(it->key);
+            it = this->entries_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+/** \internal */
+bool GEProgramCache::enabled() const {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return this->max_entries_ > 0;
+}
+
+/**
+ * \internal
+ * Look up a cached program and mark it as most recently used. File entries whose modification
+ * time or size no longer match are dropped. The returned program stays valid while it is held,
+ * even if it is evicted in the meantime.
+ */
+std::shared_ptr<ProgramHandle_t> GEProgramCache::find(WorkspaceHandle_t *wh, Kind kind, const std::string &text, long long mtime, long long size) {
+    Key key = { wh, kind, text };
+
+    std::lock_guard<std::mutex> guard(mutex_);
+
+    std::unordered_map<Key, EntryList::iterator, KeyHash>::iterator it = this->index_.find(key);
+
+    if (it == this->index_.end()) {
+        ++this->misses_;
+        return std::shared_ptr<ProgramHandle_t>();
+    }
+
+    EntryList::iterator entry = it->second;
+
+    if (entry->mtime != mtime || entry->size != size) {
+        this->entries_.erase(entry);
+        this->index_.erase(it);
+        ++this->misses_;
+        return std::shared_ptr<ProgramHandle_t>();
+    }
+
+    this->entries_.splice(this->entries_.begin(), this->entries_, entry);
+    ++this->hits_;
+
+    return entry->program;
+}
+
+/**
+ * \internal
+ * Take ownership of a freshly compiled program and cache it. If another thread cached the same
+ * program first, that one is returned and _ph_ is freed.
+ */
+std::shared_ptr<ProgramHandle_t> GEProgramCache::insert(WorkspaceHandle_t *wh, Kind kind, const std::string &text, ProgramHandle_t *ph, long long mtime, long long size) {
+    std::shared_ptr<ProgramHandle_t> program(ph, freeCachedProgram);
+    Key key = { wh, kind, text };
+
+    std::lock_guard<std::mutex> guard(mutex_);
+
+    if (this->max_entries_ <= 0)
+        return program;
+
+    std::unordered_map<Key, EntryList::iterator, KeyHash>::iterator it = this->index_.find(key);
+
+    if (it != this->index_.end()) {
+        EntryList::iterator entry = it->second;
+
+        if (entry->mtime == mtime && entry->size == size)
+            return entry->program;
+
+        this->entries_.erase(entry);
+        this->index_.erase(it);
+    }
+
+    Entry entry = { key, mtime, size, program };
+    this->entries_.push_front(entry);
+    this->index_[key] = this->entries_.begin();
+
+    trim();
+
+    return program;
+}
+
+void GEProgramCache::trim() {
+    while ((int)this->index_.size() > this->max_entries_) {
+        this->index_.erase(this->entries_.back().key);
+        this->entries_.pop_back();
+    }
+}
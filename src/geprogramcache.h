@@ -0,0 +1,84 @@
+#ifndef GEPROGRAMCACHE_H
+#define GEPROGRAMCACHE_H
+
+#include "gauss.h"
+#include <string>
+#include <list>
+#include <unordered_map>
+#include <memory>
+#include <mutex>
+
+/**
+ * Least-recently-used cache of compiled programs, used by GAUSS::executeString() and
+ * GAUSS::executeFile() to skip the compiler for commands that have run before. Retrieve it with
+ * GAUSS::getProgramCache().
+ *
+ * The cache is disabled until setMaxEntries() is given a positive size. Programs are cached per
+ * workspace, keyed by the source code for strings and by the path, modification time and size
+ * for files. A cached program is not recompiled when procedures or globals it was compiled
+ * against are redefined elsewhere; call invalidate() or clear() after such changes.
+ */
+class GAUSS_EXPORT GEProgramCache
+{
+public:
+    GEProgramCache();
+    ~GEProgramCache();
+
+    void setMaxEntries(int maxEntries);
+    int maxEntries() const;
+    int count() const;
+
+    long long hits() const;
+    long long misses() const;
+    void resetStats();
+
+    void clear();
+    void invalidate(GEWorkspace *workspace);
+
+#ifndef SWIG
+    enum Kind {
+        SOURCE_STRING,
+        SOURCE_FILE
+    };
+
+    bool enabled() const;
+    std::shared_ptr<ProgramHandle_t> find(WorkspaceHandle_t *wh, Kind kind, const std::string &text, long long mtime = 0, long long size = 0);
+    std::shared_ptr<ProgramHandle_t> insert(WorkspaceHandle_t *wh, Kind kind, const std::string &text, ProgramHandle_t *ph, long long mtime = 0, long long size = 0);
+    void invalidate(WorkspaceHandle_t *wh);
+#endif
+
+private:
+    struct Key {
+        WorkspaceHandle_t *wh;
+        int kind;
+        std::string text;
+
+        bool operator==(const Key &other) const { return wh == other.wh && kind == other.kind && text == other.text; }
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key &key) const;
+    };
+
+    struct Entry {
+        Key key;
+        long long mtime;
+        long long size;
+        std::shared_ptr<ProgramHandle_t> program;
+    };
+
+    typedef std::list<Entry> EntryList;
+
+    void trim();
+
+    // Most recently used first
+    EntryList entries_;
+    std::unordered_map<Key, EntryList::iterator, KeyHash> index_;
+    mutable std::mutex mutex_;
+
+    int max_entries_;
+    long long hits_;
+    long long misses_;
+};
+
+#endif // GEPROGRAMCACHE_H
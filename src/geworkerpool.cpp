@@ -0,0 +1,131 @@
+#include "geworkerpool.h"
+
+// Pool whose task is running on this thread, if any
+static thread_local const GEWorkerPool *kCurrentPool = nullptr;
+
+GEWorkerPool::GEWorkerPool(int threads) : stop_(false) {
+    if (threads < 1)
+        threads = 1;
+
+    for (int i = 0; i < threads; ++i)
+        this->threads_.push_back(std::thread(&GEWorkerPool::run, this));
+}
+
+/**
+ * Finishes every queued task before joining the worker threads.
+ */
+GEWorkerPool::~GEWorkerPool() {
+    waitAll();
+
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        this->stop_ = true;
+    }
+
+    this->work_cv_.notify_all();
+
+    for (size_t i = 0; i < this->threads_.size(); ++i)
+        this->threads_[i].join();
+}
+
+int GEWorkerPool::threadCount() const {
+    return this->threads_.size();
+}
+
+void GEWorkerPool::post(const void *key, const Task &task) {
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        Queue &queue = this->queues_[key];
+
+        // A key is only listed as ready when it is idle, so tasks for it never overlap
+        if (queue.tasks.empty() && !queue.running)
+            this->ready_.push_back(key);
+
+        queue.tasks.push_back(task);
+    }
+
+    this->work_cv_.notify_one();
+}
+
+/**
+ * Block until every task queued for _key_ has finished. Returns false without waiting if tasks
+ * are queued for _key_ and this is called from one of the pool's tasks.
+ */
+bool GEWorkerPool::wait(const void *key) {
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    if (this->queues_.count(key) && isWorkerThread())
+        return false;
+
+    while (this->queues_.count(key))
+        this->idle_cv_.wait(lock);
+
+    return true;
+}
+
+/**
+ * Block until every queued task has finished. Returns false without waiting if this is called
+ * from one of the pool's tasks.
+ */
+bool GEWorkerPool::waitAll() {
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    if (!this->queues_.empty() && isWorkerThread())
+        return false;
+
+    while (!this->queues_.empty())
+        this->idle_cv_.wait(lock);
+
+    return true;
+}
+
+/**
+ * Return whether the calling thread is running one of the pool's tasks.
+ */
+bool GEWorkerPool::isWorkerThread() const {
+    return kCurrentPool == this;
+}
+
+void GEWorkerPool::run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    while (true) {
+        while (!this->stop_ && this->ready_.empty())
+            this->work_cv_.wait(lock);
+
+        if (this->ready_.empty())
+            return;
+
+        const void *key = this->ready_.front();
+        this->ready_.pop_front();
+
+        Queue &queue = this->queues_[key];
+        Task task = queue.tasks.front();
+        queue.tasks.pop_front();
+        queue.running = true;
+
+        lock.unlock();
+        kCurrentPool = this;
+
+        // Anything a task lets escape is dropped, so the key is never left marked as running
+        try {
+            task();
+        } catch (...) {
+        }
+
+        kCurrentPool = nullptr;
+        lock.lock();
+
+        // The map may have been rehashed while unlocked
+        Queue &current = this->queues_[key];
+        current.running = false;
+
+        if (current.tasks.empty()) {
+            this->queues_.erase(key);
+            this->idle_cv_.notify_all();
+        } else {
+            this->ready_.push_back(key);
+            this->work_cv_.notify_one();
+        }
+    }
+}
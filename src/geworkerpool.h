@@ -0,0 +1,62 @@
+#ifndef GEWORKERPOOL_H
+#define GEWORKERPOOL_H
+
+#include <functional>
+#include <deque>
+#include <unordered_map>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+/**
+ * \internal
+ * Fixed-size thread pool used for asynchronous execution. Every task has an affinity key
+ * (the workspace handle it runs in). Tasks with the same key run one at a time, in the order
+ * they were queued; tasks with different keys run in parallel.
+ *
+ * A task that throws is abandoned without affecting the queue of its key. Waiting from inside a
+ * task could wait for the task itself, or hold the only worker thread, so wait() and waitAll()
+ * refuse to block on a worker thread of the pool and return false instead.
+ */
+class GEWorkerPool
+{
+public:
+    typedef std::function<void()> Task;
+
+    explicit GEWorkerPool(int threads);
+    ~GEWorkerPool();
+
+    int threadCount() const;
+
+    void post(const void *key, const Task &task);
+    bool wait(const void *key);
+    bool waitAll();
+    bool isWorkerThread() const;
+
+private:
+    GEWorkerPool(const GEWorkerPool&);
+    GEWorkerPool& operator=(const GEWorkerPool&);
+
+    void run();
+
+    struct Queue {
+        Queue() : running(false) {}
+
+        std::deque<Task> tasks;
+        bool running;
+    };
+
+    std::vector<std::thread> threads_;
+    std::unordered_map<const void*, Queue> queues_;
+
+    // Keys that have queued tasks and no task running
+    std::deque<const void*> ready_;
+
+    std::mutex mutex_;
+    std::condition_variable work_cv_;
+    std::condition_variable idle_cv_;
+    bool stop_;
+};
+
+#endif // GEWORKERPOOL_H
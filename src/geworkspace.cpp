@@ -5,11 +5,15 @@
 GEWorkspace::GEWorkspace(WorkspaceHandle_t *wh)
 {
     this->workspace_ = wh;
+    this->ref_ = std::make_shared<WorkspaceHandle_t*>(wh);
+    this->epoch_ = std::make_shared<std::atomic<unsigned int> >(0);
 }
 
 GEWorkspace::GEWorkspace(const std::string &name, WorkspaceHandle_t *wh) {
     this->name_ = name;
     this->workspace_ = wh;
+    this->ref_ = std::make_shared<WorkspaceHandle_t*>(wh);
+    this->epoch_ = std::make_shared<std::atomic<unsigned int> >(0);
 }
 
 GEWorkspace::~GEWorkspace() {
@@ -31,6 +35,7 @@ void GEWorkspace::setWorkspace(WorkspaceHandle_t *wh) {
     memset(&name, 0, sizeof(name));
     GAUSS_GetWorkspaceName(wh, name);
     this->workspace_ = wh;
+    this->ref_ = std::make_shared<WorkspaceHandle_t*>(wh);
     this->name_ = std::string(name);
 }
 
@@ -38,7 +43,25 @@ WorkspaceHandle_t* GEWorkspace::workspace() {
     return this->workspace_;
 }
 
+/** \internal */
+std::weak_ptr<WorkspaceHandle_t*> GEWorkspace::handleRef() const {
+    return this->ref_;
+}
+
+/** \internal */
+std::weak_ptr<std::atomic<unsigned int> > GEWorkspace::epochRef() const {
+    return this->epoch_;
+}
+
+/** \internal Mark the symbols of this workspace as possibly reassigned. */
+void GEWorkspace::touch() {
+    ++*this->epoch_;
+}
+
 void GEWorkspace::clear() {
+    // Expire any outstanding references before the handle goes away
+    this->ref_.reset();
+
     if (this->workspace_)
         GAUSS_FreeWorkspace(this->workspace_);
 
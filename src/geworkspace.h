@@ -5,6 +5,8 @@
 #include "gauss.h"
 #include <cstdlib>
 #include <string>
+#include <memory>
+#include <atomic>
 
 /**
   * Wrapper for a WorkspaceHandle_t* object.
@@ -25,9 +27,23 @@ public:
 
     void clear();
 
+#ifndef SWIG
+    std::weak_ptr<WorkspaceHandle_t*> handleRef() const;
+    std::weak_ptr<std::atomic<unsigned int> > epochRef() const;
+    void touch();
+#endif
+
 private:
     std::string name_;
     WorkspaceHandle_t *workspace_;
+
+    // Shared with objects that reference symbol table memory (i.e. GEMatrixView)
+    // so they can detect the workspace being freed.
+    std::shared_ptr<WorkspaceHandle_t*> ref_;
+
+    // Advanced whenever a symbol in this workspace may have been reassigned, so a GEMatrixView
+    // only looks its symbol up again after writes to its own workspace.
+    std::shared_ptr<std::atomic<unsigned int> > epoch_;
 };
 
 #endif // GEWORKSPACE_H
@@ -0,0 +1,492 @@
+#include "geworkspacepool.h"
+#include "geworkspace.h"
+#include "geprogramcache.h"
+#include "geworkspacesnapshot.h"
+#include <chrono>
+#include <vector>
+
+/** \internal */
+GEWorkspacePool::GEWorkspacePool(GAUSS *ge) : ge_(ge), active_(false), min_size_(0), max_size_(0),
+    pending_(0), next_id_(0), reset_command_("new;") {
+    resetStats();
+}
+
+GEWorkspacePool::~GEWorkspacePool() {
+}
+
+/**
+ * Set the number of workspaces the pool keeps. The pool is filled to _minSize_ straight away if
+ * the engine is initialized, and never holds more than _maxSize_ workspaces; acquire() waits
+ * once that many are in use. A _maxSize_ of `0` places no limit on the pool. Idle workspaces
+ * above the new maximum are destroyed.
+ *
+ * Example:
+ *
+__Python__
+```py
+pool = ge.getWorkspacePool()
+pool.setSetupCommand("library pgraph; load x = data.csv;")
+pool.setSize(8, 32)
+
+wh = pool.acquire()
+ge.executeString("y = x * 2", wh)
+pool.release(wh)
+```
+ *
+ * @param minSize        Number of workspaces to keep created
+ * @param maxSize        Maximum number of workspaces, or `0` for no limit
+ */
+void GEWorkspacePool::setSize(int minSize, int maxSize) {
+    std::vector<GEWorkspace*> excess;
+
+    bool active = false;
+
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        this->min_size_ = minSize > 0 ? minSize : 0;
+        this->max_size_ = maxSize > 0 ? maxSize : 0;
+
+        if (this->max_size_ > 0 && this->min_size_ > this->max_size_)
+            this->min_size_ = this->max_size_;
+
+        while (this->max_size_ > 0 && !this->idle_.empty() &&
+               (int)(this->idle_.size() + this->busy_.size()) > this->max_size_) {
+            excess.push_back(this->idle_.back());
+            this->idle_.pop_back();
+        }
+
+        active = this->active_;
+    }
+
+    for (size_t i = 0; i < excess.size(); ++i)
+        this->ge_->destroyWorkspace(excess.at(i));
+
+    if (active)
+        fill();
+
+    cond_.notify_all();
+}
+
+/**
+ * Return the number of workspaces the pool keeps created.
+ */
+int GEWorkspacePool::minSize() const {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return this->min_size_;
+}
+
+/**
+ * Return the maximum number of workspaces in the pool, or `0` if there is no limit.
+ */
+int GEWorkspacePool::maxSize() const {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return this->max_size_;
+}
+
+/**
+ * Set the code run in each workspace when it is created, such as loading libraries and reference
+ * data. The result is saved as a baseline snapshot that released workspaces are restored from, so
+ * the setup cost is paid once per workspace created rather than on every release. Only workspaces
+ * created after this call are affected.
+ *
+ * @param command        GAUSS code
+ *
+ * @see GAUSS::snapshotWorkspace(GEWorkspace*)
+ */
+void GEWorkspacePool::setSetupCommand(std::string command) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    this->setup_command_ = command;
+    this->baseline_.reset();
+}
+
+/**
+ * Return the code run to set up each workspace.
+ */
+std::string GEWorkspacePool::setupCommand() const {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return this->setup_command_;
+}
+
+/**
+ * Set the code run in a workspace when it is released and there is no baseline snapshot to
+ * restore, before the setup command runs again. The default is `new;`, which clears the
+ * workspace. An empty command hands workspaces back out as they were left, for callers that clean
+ * up after themselves; the baseline snapshot is not restored either.
+ *
+ * @param command        GAUSS code
+ */
+void GEWorkspacePool::setResetCommand(std::string command) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    this->reset_command_ = command;
+}
+
+/**
+ * Return the code run to reset a released workspace.
+ */
+std::string GEWorkspacePool::resetCommand() const {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return this->reset_command_;
+}
+
+/**
+ * Take a workspace out of the pool. An idle workspace is returned if there is one, otherwise a
+ * new workspace is created if the pool is below its maximum size. When the pool is exhausted this
+ * waits for another thread to call release().
+ *
+ * The workspace is not made active. Pass it to release() when done with it, rather than to
+ * GAUSS::destroyWorkspace().
+ *
+ * @param timeout        Maximum time to wait in milliseconds, or `-1` to wait indefinitely
+ * @return        Workspace, or `null` on timeout, on failure or if the engine is not initialized
+ *
+ * @see release(GEWorkspace*)
+ */
+GEWorkspace* GEWorkspacePool::acquire(int timeout) {
+    typedef std::chrono::steady_clock Clock;
+
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    if (!this->active_)
+        return nullptr;
+
+    this->acquires_++;
+
+    bool waited = false;
+    Clock::time_point start;
+    GEWorkspace *workspace = nullptr;
+
+    while (this->active_) {
+        if (!this->idle_.empty()) {
+            workspace = this->idle_.front();
+            this->idle_.pop_front();
+            break;
+        }
+
+        int total = this->idle_.size() + this->busy_.size() + this->pending_;
+
+        if (this->max_size_ == 0 || total < this->max_size_) {
+            this->pending_++;
+            lock.unlock();
+            workspace = createWorkspace();
+            lock.lock();
+            this->pending_--;
+
+            if (workspace)
+                this->created_++;
+
+            break;
+        }
+
+        if (!waited) {
+            waited = true;
+            start = Clock::now();
+            this->waits_++;
+        }
+
+        if (timeout < 0) {
+            cond_.wait(lock);
+        } else if (cond_.wait_until(lock, start + std::chrono::milliseconds(timeout)) == std::cv_status::timeout &&
+                   this->idle_.empty()) {
+            this->timeouts_++;
+            break;
+        }
+    }
+
+    if (waited)
+        this->wait_time_ += std::chrono::duration<double>(Clock::now() - start).count();
+
+    if (!workspace)
+        return nullptr;
+
+    if (!this->active_) {
+        // Drained while this workspace was being created
+        lock.unlock();
+        this->ge_->destroyWorkspace(workspace);
+        return nullptr;
+    }
+
+    this->busy_.insert(workspace);
+
+    if ((int)this->busy_.size() > this->peak_in_use_)
+        this->peak_in_use_ = this->busy_.size();
+
+    return workspace;
+}
+
+/**
+ * Return a workspace taken with acquire() to the pool. The workspace is reset to its baseline by
+ * restoring the baseline snapshot, or by running the reset and setup commands if there is none,
+ * and any programs cached for it are dropped. If the reset fails the workspace is destroyed, and
+ * the pool creates a fresh one when needed.
+ *
+ * @param workspace        Workspace returned by acquire()
+ * @return        True if the workspace was reset and can be reused, false otherwise.
+ *
+ * @see acquire(int)
+ */
+bool GEWorkspacePool::release(GEWorkspace *workspace) {
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+
+        if (!this->busy_.erase(workspace))
+            return false;
+
+        // Keep counting the workspace while it resets, so acquire() does not create another
+        this->pending_++;
+    }
+
+    bool reset = resetWorkspace(workspace);
+    bool keep = false;
+
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        this->pending_--;
+
+        int total = this->idle_.size() + this->busy_.size() + this->pending_;
+
+        keep = reset && this->active_ && (this->max_size_ == 0 || total < this->max_size_);
+
+        if (keep)
+            this->idle_.push_back(workspace);
+    }
+
+    if (!keep)
+        this->ge_->destroyWorkspace(workspace);
+
+    cond_.notify_one();
+
+    return reset;
+}
+
+/**
+ * Return the number of idle workspaces ready to be acquired.
+ */
+int GEWorkspacePool::available() const {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return this->idle_.size();
+}
+
+/**
+ * Return the number of workspaces currently acquired.
+ */
+int GEWorkspacePool::inUse() const {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return this->busy_.size();
+}
+
+/**
+ * Return the number of workspaces owned by the pool, both idle and in use.
+ */
+int GEWorkspacePool::count() const {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return this->idle_.size() + this->busy_.size();
+}
+
+/**
+ * Return the highest number of workspaces in use at once since the last resetStats().
+ */
+int GEWorkspacePool::peakInUse() const {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return this->peak_in_use_;
+}
+
+/**
+ * Return the fraction of the pool's workspaces that are in use, between `0` and `1`.
+ */
+double GEWorkspacePool::utilization() const {
+    std::lock_guard<std::mutex> guard(mutex_);
+    size_t total = this->idle_.size() + this->busy_.size();
+
+    return total ? (double)this->busy_.size() / total : 0;
+}
+
+/**
+ * Return the number of acquire() calls since the last resetStats().
+ */
+long long GEWorkspacePool::acquires() const {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return this->acquires_;
+}
+
+/**
+ * Return the number of acquire() calls that had to wait for a workspace to be released since
+ * the last resetStats().
+ */
+long long GEWorkspacePool::waits() const {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return this->waits_;
+}
+
+/**
+ * Return the number of acquire() calls that timed out since the last resetStats().
+ */
+long long GEWorkspacePool::timeouts() const {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return this->timeouts_;
+}
+
+/**
+ * Return the number of workspaces created by the pool since the last resetStats().
+ */
+long long GEWorkspacePool::created() const {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return this->created_;
+}
+
+/**
+ * Return the total time acquire() spent waiting for workspaces since the last resetStats(),
+ * in seconds.
+ */
+double GEWorkspacePool::waitTime() const {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return this->wait_time_;
+}
+
+/**
+ * Reset the counters returned by peakInUse(), acquires(), waits(), timeouts(), created()
+ * and waitTime().
+ */
+void GEWorkspacePool::resetStats() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    this->peak_in_use_ = this->busy_.size();
+    this->acquires_ = 0;
+    this->waits_ = 0;
+    this->timeouts_ = 0;
+    this->created_ = 0;
+    this->wait_time_ = 0;
+}
+
+/** \internal
+ * Create workspaces until the pool holds its minimum size. Called once the engine is initialized.
+ */
+bool GEWorkspacePool::fill() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    this->active_ = true;
+
+    while ((int)(this->idle_.size() + this->busy_.size()) + this->pending_ < this->min_size_) {
+        this->pending_++;
+        lock.unlock();
+        GEWorkspace *workspace = createWorkspace();
+        lock.lock();
+        this->pending_--;
+
+        if (!workspace)
+            return false;
+
+        this->created_++;
+        this->idle_.push_back(workspace);
+        cond_.notify_one();
+    }
+
+    return true;
+}
+
+/** \internal
+ * Destroy the idle workspaces, stop tracking the ones in use and wake any waiting acquire()
+ * calls. The pool stays empty until fill() is called again.
+ */
+void GEWorkspacePool::drain() {
+    std::deque<GEWorkspace*> idle;
+
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        this->active_ = false;
+        idle.swap(this->idle_);
+        this->busy_.clear();
+        this->baseline_.reset();
+    }
+
+    cond_.notify_all();
+
+    for (size_t i = 0; i < idle.size(); ++i)
+        this->ge_->destroyWorkspace(idle.at(i));
+}
+
+/** \internal
+ * Stop tracking a workspace that is being destroyed outside the pool.
+ */
+void GEWorkspacePool::forget(GEWorkspace *workspace) {
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+
+        for (std::deque<GEWorkspace*>::iterator it = this->idle_.begin(); it != this->idle_.end(); ++it) {
+            if (*it == workspace) {
+                this->idle_.erase(it);
+                break;
+            }
+        }
+
+        this->busy_.erase(workspace);
+    }
+
+    cond_.notify_one();
+}
+
+GEWorkspace* GEWorkspacePool::createWorkspace() {
+    std::string name;
+    std::string setup;
+
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        name = "__pool_" + std::to_string(++this->next_id_);
+        setup = this->setup_command_;
+    }
+
+    GEWorkspace *workspace = this->ge_->createWorkspace(name);
+
+    if (!workspace)
+        return nullptr;
+
+    if (setup.empty())
+        return workspace;
+
+    if (!this->ge_->executeString(setup, workspace)) {
+        this->ge_->destroyWorkspace(workspace);
+        return nullptr;
+    }
+
+    bool needBaseline = false;
+
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        needBaseline = !this->baseline_ && this->setup_command_ == setup;
+    }
+
+    if (needBaseline) {
+        std::shared_ptr<GEWorkspaceSnapshot> baseline(this->ge_->snapshotWorkspace(workspace));
+
+        std::lock_guard<std::mutex> guard(mutex_);
+
+        if (baseline && !this->baseline_ && this->setup_command_ == setup)
+            this->baseline_ = baseline;
+    }
+
+    return workspace;
+}
+
+bool GEWorkspacePool::resetWorkspace(GEWorkspace *workspace) {
+    std::string reset;
+    std::string setup;
+    std::shared_ptr<GEWorkspaceSnapshot> baseline;
+
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        reset = this->reset_command_;
+        setup = this->setup_command_;
+        baseline = this->baseline_;
+    }
+
+    if (reset.empty())
+        return true;
+
+    // Cached programs may refer to procedures the reset removes
+    this->ge_->getProgramCache()->invalidate(workspace);
+
+    if (baseline)
+        return this->ge_->restoreWorkspace(workspace, baseline.get());
+
+    if (!this->ge_->executeString(reset, workspace))
+        return false;
+
+    return setup.empty() || this->ge_->executeString(setup, workspace);
+}
@@ -0,0 +1,90 @@
+#ifndef GEWORKSPACEPOOL_H
+#define GEWORKSPACEPOOL_H
+
+#include "gauss.h"
+#include <string>
+#include <deque>
+#include <unordered_set>
+#include <mutex>
+#include <condition_variable>
+#include <memory>
+
+/**
+ * Pool of pre-created workspaces for handing each request an isolated workspace without paying
+ * for GAUSS_CreateWorkspace() and its setup every time. Retrieve it with GAUSS::getWorkspacePool().
+ *
+ * The pool is filled to its minimum size by GAUSS::initialize(), or when setSize() is called on
+ * an initialized engine. Every workspace runs the setup command once when it is created, and the
+ * first workspace set up is saved as a baseline snapshot. On release() a workspace is returned to
+ * that baseline by restoring the snapshot, so the setup command is not run again; without a setup
+ * command, or if the snapshot cannot be taken, the reset command is run followed by the setup
+ * command. A workspace that fails to reset is destroyed rather than handed out again.
+ */
+class GAUSS_EXPORT GEWorkspacePool
+{
+public:
+    void setSize(int minSize, int maxSize);
+    int minSize() const;
+    int maxSize() const;
+
+    void setSetupCommand(std::string command);
+    std::string setupCommand() const;
+    void setResetCommand(std::string command);
+    std::string resetCommand() const;
+
+    GEWorkspace* acquire(int timeout = -1);
+    bool release(GEWorkspace *workspace);
+
+    int available() const;
+    int inUse() const;
+    int count() const;
+    int peakInUse() const;
+    double utilization() const;
+
+    long long acquires() const;
+    long long waits() const;
+    long long timeouts() const;
+    long long created() const;
+    double waitTime() const;
+    void resetStats();
+
+#ifndef SWIG
+    GEWorkspacePool(GAUSS *ge);
+    ~GEWorkspacePool();
+
+    bool fill();
+    void drain();
+    void forget(GEWorkspace *workspace);
+#endif
+
+private:
+    GEWorkspace* createWorkspace();
+    bool resetWorkspace(GEWorkspace *workspace);
+
+    GAUSS *ge_;
+
+    // Workspace state right after setup, restored on release
+    std::shared_ptr<GEWorkspaceSnapshot> baseline_;
+
+    std::deque<GEWorkspace*> idle_;
+    std::unordered_set<GEWorkspace*> busy_;
+    mutable std::mutex mutex_;
+    std::condition_variable cond_;
+
+    bool active_;
+    int min_size_;
+    int max_size_;
+    int pending_;
+    unsigned int next_id_;
+    std::string setup_command_;
+    std::string reset_command_;
+
+    int peak_in_use_;
+    long long acquires_;
+    long long waits_;
+    long long timeouts_;
+    long long created_;
+    double wait_time_;
+};
+
+#endif // GEWORKSPACEPOOL_H
@@ -0,0 +1,121 @@
+#include "geworkspacesnapshot.h"
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#ifdef _WIN32
+#include "windows.h"
+#include <sys/stat.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#endif
+
+/** \internal */
+GEWorkspaceSnapshot::GEWorkspaceSnapshot(const std::string &name)
+    : name_(name), fd_(-1), unlink_(false) {
+}
+
+GEWorkspaceSnapshot::~GEWorkspaceSnapshot() {
+#ifndef _WIN32
+    if (this->fd_ >= 0)
+        close(this->fd_);
+#endif
+
+    if (this->unlink_)
+        remove(this->path_.c_str());
+}
+
+/** \internal
+ * Create the backing storage for the saved workspace. On Linux this is an anonymous memory file,
+ * which the engine writes and reads through its `/proc/self/fd` path.
+ */
+bool GEWorkspaceSnapshot::open() {
+#ifdef _WIN32
+    char dir[MAX_PATH];
+    char file[MAX_PATH];
+
+    if (!GetTempPathA(MAX_PATH, dir) || !GetTempFileNameA(dir, "gws", 0, file))
+        return false;
+
+    this->path_ = file;
+    this->unlink_ = true;
+#else
+#ifdef SYS_memfd_create
+    this->fd_ = syscall(SYS_memfd_create, "gauss-workspace", 1 /* MFD_CLOEXEC */);
+
+    if (this->fd_ >= 0) {
+        this->path_ = "/proc/self/fd/" + std::to_string(this->fd_);
+        return true;
+    }
+#endif
+
+    // Prefer tmpfs, so the snapshot stays in memory
+    const char *tmpdir = getenv("TMPDIR");
+    std::string dirs[] = { "/dev/shm", tmpdir ? tmpdir : "", "/tmp" };
+
+    for (size_t i = 0; i < sizeof(dirs) / sizeof(dirs[0]) && this->fd_ < 0; ++i) {
+        if (dirs[i].empty())
+            continue;
+
+        std::string tmpl = dirs[i] + "/gauss-workspace-XXXXXX";
+        std::vector<char> buf(tmpl.begin(), tmpl.end());
+        buf.push_back('\0');
+
+        this->fd_ = mkstemp(buf.data());
+
+        if (this->fd_ >= 0) {
+            this->path_ = buf.data();
+            this->unlink_ = true;
+        }
+    }
+
+    if (this->fd_ < 0)
+        return false;
+#endif
+
+    return true;
+}
+
+/**
+ * Return whether the snapshot holds a saved workspace.
+ */
+bool GEWorkspaceSnapshot::isValid() const {
+    return size() > 0;
+}
+
+/**
+ * Return the name of the workspace the snapshot was taken from.
+ */
+std::string GEWorkspaceSnapshot::name() const {
+    return this->name_;
+}
+
+/**
+ * Return the size of the saved workspace in bytes.
+ */
+size_t GEWorkspaceSnapshot::size() const {
+    if (this->path_.empty())
+        return 0;
+
+#ifdef _WIN32
+    struct _stat64 info;
+
+    if (_stat64(this->path_.c_str(), &info) != 0)
+        return 0;
+#else
+    struct stat info;
+
+    if (fstat(this->fd_, &info) != 0)
+        return 0;
+#endif
+
+    return info.st_size;
+}
+
+/** \internal */
+std::string GEWorkspaceSnapshot::path() const {
+    return this->path_;
+}
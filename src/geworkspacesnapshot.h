@@ -0,0 +1,41 @@
+#ifndef GEWORKSPACESNAPSHOT_H
+#define GEWORKSPACESNAPSHOT_H
+
+#include "gauss.h"
+#include <string>
+
+/**
+ * In-memory copy of a workspace taken with GAUSS::snapshotWorkspace(), and restored with
+ * GAUSS::restoreWorkspace(). The saved workspace is held in an anonymous memory file where the
+ * platform provides one (`memfd` on Linux), otherwise in a temporary file on tmpfs if available,
+ * and is released when the snapshot is deleted.
+ *
+ * A snapshot can be restored any number of times, and any number of snapshots can be kept.
+ */
+class GAUSS_EXPORT GEWorkspaceSnapshot
+{
+public:
+    ~GEWorkspaceSnapshot();
+
+    bool isValid() const;
+    std::string name() const;
+    size_t size() const;
+
+#ifndef SWIG
+    GEWorkspaceSnapshot(const std::string &name);
+
+    bool open();
+    std::string path() const;
+#endif
+
+private:
+    GEWorkspaceSnapshot(const GEWorkspaceSnapshot&);
+    GEWorkspaceSnapshot& operator=(const GEWorkspaceSnapshot&);
+
+    std::string name_;
+    std::string path_;
+    int fd_;
+    bool unlink_;
+};
+
+#endif // GEWORKSPACESNAPSHOT_H
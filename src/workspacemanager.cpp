@@ -2,86 +2,173 @@
 #include "geworkspace.h"
 #include <cstring>
 
+namespace {
+
+class ReadLocker
+{
+public:
+    explicit ReadLocker(pthread_rwlock_t *lock) : lock_(lock) { pthread_rwlock_rdlock(lock_); }
+    ~ReadLocker() { pthread_rwlock_unlock(lock_); }
+
+private:
+    pthread_rwlock_t *lock_;
+};
+
+class WriteLocker
+{
+public:
+    explicit WriteLocker(pthread_rwlock_t *lock) : lock_(lock) { pthread_rwlock_wrlock(lock_); }
+    ~WriteLocker() { pthread_rwlock_unlock(lock_); }
+
+private:
+    pthread_rwlock_t *lock_;
+};
+
+// Active workspace bound by the calling thread in thread-local mode
+struct ThreadBinding {
+    const WorkspaceManager *owner;
+    GEWorkspace *workspace;
+    unsigned int epoch;
+};
+
+thread_local ThreadBinding kThreadBinding = { nullptr, nullptr, 0 };
+
+}
 
 WorkspaceManager::WorkspaceManager() 
-    : current_(0)
+    : current_(nullptr), threadLocal_(false), epoch_(0)
 {
+    pthread_rwlock_init(&lock_, nullptr);
+}
 
+WorkspaceManager::~WorkspaceManager() {
+    pthread_rwlock_destroy(&lock_);
 }
 
 GEWorkspace* WorkspaceManager::getCurrent() const {
-    std::lock_guard<std::mutex> guard(mutex_);
-    return current_;
+    if (threadLocal_.load(std::memory_order_relaxed) && kThreadBinding.owner == this) {
+        unsigned int epoch = epoch_.load(std::memory_order_acquire);
+
+        // Only consult the registry if a workspace was destroyed since the last check
+        if (kThreadBinding.epoch != epoch) {
+            if (!contains(kThreadBinding.workspace))
+                kThreadBinding.owner = nullptr;
+
+            kThreadBinding.epoch = epoch;
+        }
+
+        if (kThreadBinding.owner == this)
+            return kThreadBinding.workspace;
+    }
+
+    return getDefault();
 }
 
 bool WorkspaceManager::setCurrent(GEWorkspace *wh) {
-    if (!wh || !wh->workspace())
+    if (!threadLocal_.load(std::memory_order_relaxed))
+        return setDefault(wh);
+
+    if (!registerWorkspace(wh))
         return false;
 
-    mutex_.lock();
-    current_ = wh;
-    mutex_.unlock();
+    kThreadBinding.owner = this;
+    kThreadBinding.workspace = wh;
+    kThreadBinding.epoch = epoch_.load(std::memory_order_acquire);
 
-    if (!this->contains(wh)) {
-        std::lock_guard<std::mutex> guard(mutex_);
-        workspaces_.insert(std::pair<std::string, GEWorkspace*>(wh->name(), wh));
-    }
+    return true;
+}
+
+GEWorkspace* WorkspaceManager::getDefault() const {
+    return current_.load(std::memory_order_acquire);
+}
+
+bool WorkspaceManager::setDefault(GEWorkspace *wh) {
+    if (!registerWorkspace(wh))
+        return false;
+
+    current_.store(wh, std::memory_order_release);
 
     return true;
 }
 
-bool WorkspaceManager::contains(GEWorkspace *wh) const {
-    std::unordered_map<std::string, GEWorkspace*>::const_iterator it;
+void WorkspaceManager::setThreadLocal(bool enabled) {
+    threadLocal_.store(enabled, std::memory_order_relaxed);
+}
 
-    std::lock_guard<std::mutex> guard(mutex_);
+bool WorkspaceManager::isThreadLocal() const {
+    return threadLocal_.load(std::memory_order_relaxed);
+}
 
-    for (it = workspaces_.begin(); it != workspaces_.end(); ++it) {
-        if (it->second == wh)
-            return true;
-    }
+void WorkspaceManager::clearThreadCurrent() {
+    if (kThreadBinding.owner == this)
+        kThreadBinding.owner = nullptr;
+}
 
-    return false;
+bool WorkspaceManager::contains(GEWorkspace *wh) const {
+    ReadLocker locker(&lock_);
+    return index_.count(wh) > 0;
 }
 
 GEWorkspace* WorkspaceManager::getWorkspace(const std::string &name) const {
-    std::lock_guard<std::mutex> guard(mutex_);
+    ReadLocker locker(&lock_);
 
-    if (workspaces_.find(name) == workspaces_.end())
-        return 0;
+    std::unordered_map<std::string, GEWorkspace*>::const_iterator it = workspaces_.find(name);
 
-    return workspaces_.at(name);
+    return it != workspaces_.end() ? it->second : nullptr;
 }
 
 void WorkspaceManager::destroyAll() {
-    if (workspaces_.empty())
-        return;
-
-    std::lock_guard<std::mutex> guard(mutex_);
-
-    std::unordered_map<std::string, GEWorkspace*>::iterator it;
-    for (it = workspaces_.begin(); it != workspaces_.end();) {
-        GEWorkspace *wh = it->second;
-        delete wh;
-        it = workspaces_.erase(it);
+    std::unordered_set<GEWorkspace*> removed;
+
+    {
+        WriteLocker locker(&lock_);
+        removed.swap(index_);
+        workspaces_.clear();
+        current_.store(nullptr, std::memory_order_release);
+        epoch_++;
     }
+
+    std::unordered_set<GEWorkspace*>::iterator it;
+    for (it = removed.begin(); it != removed.end(); ++it)
+        delete *it;
 }
 
 bool WorkspaceManager::isValidWorkspace(GEWorkspace *wh) const {
-    return wh && wh->workspace();
+    return wh && containsLive(wh);
 }
 
-bool WorkspaceManager::destroy(GEWorkspace *wh) {
-    if (current_ == wh)
-        current_ = 0;
+// Check the registry before touching wh, and hold the lock while reading it, so a workspace
+// destroyed on another thread is rejected rather than dereferenced
+bool WorkspaceManager::containsLive(GEWorkspace *wh) const {
+    ReadLocker locker(&lock_);
+    return index_.count(wh) > 0 && wh->workspace();
+}
 
-    if (!wh || !wh->workspace())
+bool WorkspaceManager::destroy(GEWorkspace *wh) {
+    if (!wh)
         return false;
 
-    mutex_.lock();
-    std::unordered_map<std::string, GEWorkspace*>::iterator it = workspaces_.find(wh->name());
-    if (it != workspaces_.end())
-        this->workspaces_.erase(it);
-    mutex_.unlock();
+    GEWorkspace *expected = wh;
+    current_.compare_exchange_strong(expected, nullptr, std::memory_order_acq_rel);
+
+    {
+        WriteLocker locker(&lock_);
+
+        if (!index_.erase(wh))
+            return false;
+
+        std::unordered_map<std::string, GEWorkspace*>::iterator it = workspaces_.find(wh->name());
+
+        // Fall back to a scan if the workspace was renamed after it was registered
+        if (it == workspaces_.end() || it->second != wh) {
+            for (it = workspaces_.begin(); it != workspaces_.end() && it->second != wh; ++it);
+        }
+
+        if (it != workspaces_.end())
+            this->workspaces_.erase(it);
+
+        epoch_++;
+    }
 
     delete wh;
 
@@ -89,13 +176,22 @@ bool WorkspaceManager::destroy(GEWorkspace *wh) {
 }
 
 GEWorkspace* WorkspaceManager::create(const std::string &name) {
+    return create(name, true);
+}
+
+// Like create(), but fails rather than returning a workspace that already has this name
+GEWorkspace* WorkspaceManager::createUnique(const std::string &name) {
+    return create(name, false);
+}
+
+GEWorkspace* WorkspaceManager::create(const std::string &name, bool reuse) {
     if (name.empty())
         return nullptr;
 
     GEWorkspace *ews = this->getWorkspace(name);
 
     if (ews)
-        return ews;
+        return reuse ? ews : nullptr;
 
     WorkspaceHandle_t *wh = GAUSS_CreateWorkspace(const_cast<char*>(name.c_str()));
 
@@ -104,8 +200,17 @@ GEWorkspace* WorkspaceManager::create(const std::string &name) {
 
     GEWorkspace *workspace = new GEWorkspace(name, wh);
 
-    std::lock_guard<std::mutex> guard(mutex_);
-    workspaces_.insert(std::pair<std::string, GEWorkspace*>(name, workspace));
+    WriteLocker locker(&lock_);
+
+    // Another thread may have created the same name meanwhile
+    std::unordered_map<std::string, GEWorkspace*>::iterator it = workspaces_.find(name);
+
+    if (it != workspaces_.end()) {
+        delete workspace;
+        return reuse ? it->second : nullptr;
+    }
+
+    insert(workspace);
 
     return workspace;
 }
@@ -113,20 +218,36 @@ GEWorkspace* WorkspaceManager::create(const std::string &name) {
 std::vector<std::string> WorkspaceManager::workspaceNames() const {
     std::vector<std::string> names;
 
-    std::lock_guard<std::mutex> guard(mutex_);
+    ReadLocker locker(&lock_);
 
     names.reserve(workspaces_.size());
 
     std::unordered_map<std::string, GEWorkspace*>::const_iterator it;
 
-    int count = 0;
-
     for (it = workspaces_.begin(); it != workspaces_.end(); ++it)
-        names.at(count++) = it->first;
+        names.push_back(it->first);
 
     return names;
 }
 
 int WorkspaceManager::count() const {
-    return workspaces_.size();
+    ReadLocker locker(&lock_);
+    return index_.size();
+}
+
+bool WorkspaceManager::registerWorkspace(GEWorkspace *wh) {
+    if (!wh || !wh->workspace())
+        return false;
+
+    if (!this->contains(wh)) {
+        WriteLocker locker(&lock_);
+        insert(wh);
+    }
+
+    return true;
+}
+
+void WorkspaceManager::insert(GEWorkspace *wh) {
+    index_.insert(wh);
+    workspaces_.insert(std::pair<std::string, GEWorkspace*>(wh->name(), wh));
 }
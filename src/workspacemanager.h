@@ -4,32 +4,61 @@
 #include "gauss.h"
 #include <stdio.h>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
-#include <mutex>
+#include <atomic>
+#include <pthread.h>
 #include <iostream>
 
+/**
+ * Registry of the workspaces known to GAUSS. Lookups far outnumber changes, so the registry is
+ * guarded by a reader/writer lock and the active workspace is held in an atomic that is read
+ * without locking.
+ *
+ * In thread-local mode each thread may bind its own active workspace, and threads without one
+ * fall back to the shared default.
+ */
 class GAUSS_EXPORT WorkspaceManager
 {
 public:
     WorkspaceManager();
+    ~WorkspaceManager();
 
     GEWorkspace* getCurrent() const;
     bool setCurrent(GEWorkspace *wh);
+    GEWorkspace* getDefault() const;
+    bool setDefault(GEWorkspace *wh);
+
+    void setThreadLocal(bool enabled);
+    bool isThreadLocal() const;
+    void clearThreadCurrent();
 
     GEWorkspace* getWorkspace(const std::string &) const;
     void destroyAll();
     bool destroy(GEWorkspace*);
     GEWorkspace* create(const std::string &);
+    GEWorkspace* createUnique(const std::string &);
     std::vector<std::string> workspaceNames() const;
     int count() const;
     bool contains(GEWorkspace*) const;
     bool isValidWorkspace(GEWorkspace*) const;
 
 private:
+    void insert(GEWorkspace*);
+    bool containsLive(GEWorkspace*) const;
+    GEWorkspace* create(const std::string &, bool reuse);
+    bool registerWorkspace(GEWorkspace*);
+
+    // Name lookup, and the set of live workspaces used for validation
     std::unordered_map<std::string, GEWorkspace*> workspaces_;
-    mutable std::mutex mutex_;
+    std::unordered_set<GEWorkspace*> index_;
+    mutable pthread_rwlock_t lock_;
+
+    std::atomic<GEWorkspace*> current_;
+    std::atomic<bool> threadLocal_;
 
-    GEWorkspace *current_;
+    // Advanced whenever a workspace is destroyed, so threads re-validate their binding
+    std::atomic<unsigned int> epoch_;
 };
 
 #endif // WORKSPACEMANAGER_H